@@ -0,0 +1,237 @@
+#pragma once
+#include "PantheonCore/ECS/Entity.h"
+#include "PantheonCore/Utility/TypeId.h"
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace PantheonCore::ECS
+{
+    class ArchetypeStorage;
+    class EntityHandle;
+
+    /**
+     * \brief A table of the entities owning exactly the same set of archetype components.\n
+     * Rows are packed in fixed-size chunks holding the owners followed by one contiguous column per component type,
+     * which keeps the components of consecutive entities next to each other in memory
+     */
+    class Archetype
+    {
+    public:
+        using Index = size_t;
+        using TypeId = Utility::TypeId;
+
+        static constexpr Index  INVALID_INDEX = std::numeric_limits<Index>::max();
+        static constexpr size_t CHUNK_SIZE    = 16 * 1024;
+
+        /**
+         * \brief The type-erased description of an archetype column's component type
+         */
+        struct ColumnType
+        {
+            TypeId m_typeId;
+            size_t m_size;
+            size_t m_alignment;
+
+            void (*relocate)(void* target, void* source);
+            void (*copy)(void* target, const void* source);
+            void (*destroy)(void* component);
+            void (*onAdd)(EntityHandle owner, void* component);
+            void (*onRemove)(EntityHandle owner, void* component);
+
+            /**
+             * \brief Gets the column type description of the given component type
+             * \tparam T The component type
+             * \return The given component type's column description
+             */
+            template <typename T>
+            static const ColumnType& get();
+        };
+
+        /**
+         * \brief Creates an empty archetype with the given component columns
+         * \param columnTypes The archetype's column types, sorted by type id
+         */
+        explicit Archetype(const std::vector<const ColumnType*>& columnTypes);
+
+        /**
+         * \brief Disable archetype copy
+         */
+        Archetype(const Archetype&) = delete;
+
+        /**
+         * \brief Creates a move copy of the given archetype
+         * \param other The archetype to move
+         */
+        Archetype(Archetype&& other) noexcept;
+
+        /**
+         * \brief Destroys the archetype and its components
+         */
+        ~Archetype();
+
+        /**
+         * \brief Disable archetype copy
+         */
+        Archetype& operator=(const Archetype&) = delete;
+
+        /**
+         * \brief Moves the given archetype into this one
+         * \param other The archetype to move
+         * \return A reference to the modified archetype
+         */
+        Archetype& operator=(Archetype&& other) noexcept;
+
+        /**
+         * \brief Gets the archetype's component type ids
+         * \return The archetype's sorted component type ids
+         */
+        const std::vector<TypeId>& getTypes() const;
+
+        /**
+         * \brief Gets the index of the column storing the given component type
+         * \param typeId The component's type id
+         * \return The column's index on success. INVALID_INDEX otherwise
+         */
+        Index getColumnIndex(TypeId typeId) const;
+
+        /**
+         * \brief Gets the archetype's number of component columns
+         * \return The archetype's number of component columns
+         */
+        size_t getColumnCount() const;
+
+        /**
+         * \brief Gets the component type stored in the given column
+         * \param column The column's index
+         * \return The column's component type
+         */
+        const ColumnType& getColumnType(Index column) const;
+
+        /**
+         * \brief Gets the number of entities in the archetype
+         * \return The number of entities in the archetype
+         */
+        size_t getCount() const;
+
+        /**
+         * \brief Gets the maximum number of entities stored in a single chunk
+         * \return The number of rows per chunk
+         */
+        size_t getChunkCapacity() const;
+
+        /**
+         * \brief Gets the number of chunks holding at least one entity
+         * \return The number of used chunks
+         */
+        size_t getChunkCount() const;
+
+        /**
+         * \brief Gets the number of entities stored in the given chunk
+         * \param chunk The chunk's index
+         * \return The number of entities in the chunk
+         */
+        size_t getChunkSize(Index chunk) const;
+
+        /**
+         * \brief Gets the owners column of the given chunk
+         * \param chunk The chunk's index
+         * \return A pointer to the chunk's first owner
+         */
+        const Entity* getEntities(Index chunk) const;
+
+        /**
+         * \brief Gets the given component column of the given chunk
+         * \param chunk The chunk's index
+         * \param column The column's index
+         * \return A pointer to the chunk's first component of the column's type
+         */
+        std::byte* getColumn(Index chunk, Index column);
+
+        /**
+         * \brief Gets the entity stored at the given row
+         * \param row The entity's row
+         * \return The entity stored at the given row
+         */
+        Entity getEntity(Index row) const;
+
+        /**
+         * \brief Gets the component stored at the given row and column
+         * \param row The component's row
+         * \param column The component's column
+         * \return A pointer to the component
+         */
+        void* getComponent(Index row, Index column);
+
+        /**
+         * \brief Gets the component stored at the given row and column
+         * \param row The component's row
+         * \param column The component's column
+         * \return A constant pointer to the component
+         */
+        const void* getComponent(Index row, Index column) const;
+
+        /**
+         * \brief Finds the row of the given component instance in the given column
+         * \param column The searched column
+         * \param component The searched component
+         * \return The component's row on success. INVALID_INDEX otherwise
+         */
+        Index findRow(Index column, const void* component) const;
+
+    private:
+        friend class ArchetypeStorage;
+
+        struct Column
+        {
+            const ColumnType* m_type;
+            size_t            m_offset;
+        };
+
+        std::vector<Column>                       m_columns;
+        std::vector<TypeId>                       m_types;
+        std::vector<Index>                        m_columnLookup;
+        std::vector<Index>                        m_addEdges;
+        std::vector<Index>                        m_removeEdges;
+        std::vector<std::unique_ptr<std::byte[]>> m_chunks;
+        size_t                                    m_chunkCapacity;
+        size_t                                    m_chunkSize;
+        size_t                                    m_count;
+
+        /**
+         * \brief Computes the columns' offsets for the current chunk capacity
+         * \return The number of bytes used by a full chunk
+         */
+        size_t computeLayout();
+
+        /**
+         * \brief Appends a row for the given entity. The row's components are left uninitialized
+         * \param owner The row's owner
+         * \return The added row's index
+         */
+        Index addRow(Entity owner);
+
+        /**
+         * \brief Removes the given row by moving the last one in its place.
+         * The removed row's components must have been destroyed or relocated beforehand
+         * \param row The row to remove
+         * \return The entity moved to the removed row. NULL_ENTITY if the removed row was the last one
+         */
+        Entity eraseRow(Index row);
+
+        /**
+         * \brief Destroys the components of the given row without removing it
+         * \param row The target row
+         */
+        void destroyRow(Index row);
+
+        /**
+         * \brief Destroys every row's components and keeps a single chunk allocated
+         */
+        void clear();
+    };
+}
+
+#include "PantheonCore/ECS/Archetype.inl"
@@ -0,0 +1,57 @@
+#pragma once
+#include "PantheonCore/ECS/Archetype.h"
+
+#include "PantheonCore/ECS/ComponentRegistry.h"
+#include "PantheonCore/ECS/ComponentTraits.h"
+
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+namespace PantheonCore::ECS
+{
+    template <typename T>
+    const Archetype::ColumnType& Archetype::ColumnType::get()
+    {
+        static_assert(!std::is_const_v<T>);
+        static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "Archetype components can't be over-aligned");
+
+        static const ColumnType type
+        {
+            .m_typeId = ComponentRegistry::getTypeId<T>(),
+            .m_size = sizeof(T),
+            .m_alignment = alignof(T),
+            .relocate = [](void* target, void* source)
+            {
+                if constexpr (std::is_trivially_copyable_v<T>)
+                {
+                    std::memcpy(target, source, sizeof(T));
+                }
+                else
+                {
+                    T* instance = static_cast<T*>(source);
+                    new(target) T(std::move(*instance));
+                    instance->~T();
+                }
+            },
+            .copy = [](void* target, const void* source)
+            {
+                new(target) T(*static_cast<const T*>(source));
+            },
+            .destroy = std::is_trivially_destructible_v<T> ? nullptr : +[](void* component)
+            {
+                static_cast<T*>(component)->~T();
+            },
+            .onAdd = [](const EntityHandle owner, void* component)
+            {
+                ComponentTraits::onAdd<T>(owner, *static_cast<T*>(component));
+            },
+            .onRemove = [](const EntityHandle owner, void* component)
+            {
+                ComponentTraits::onRemove<T>(owner, *static_cast<T*>(component));
+            }
+        };
+
+        return type;
+    }
+}
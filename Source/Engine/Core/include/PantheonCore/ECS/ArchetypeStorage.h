@@ -0,0 +1,293 @@
+#pragma once
+#include "PantheonCore/ECS/Archetype.h"
+
+#include <map>
+#include <mutex>
+
+namespace PantheonCore::ECS
+{
+    class Scene;
+
+    /**
+     * \brief Stores components grouped by archetype: entities owning the same set of component types share a chunked table.\n
+     * Adding or removing a component moves the entity's row to the matching archetype, found through a graph of
+     * add/remove edges cached on each archetype. Queries for the archetypes owning a set of component types are cached and
+     * kept up to date as archetypes get created.\n
+     * Components are relocated (moved) when their owner changes archetype or when another row is removed from their
+     * archetype - pointers and references to components are only stable until the next structural change.
+     * The components' ComponentTraits hooks are invoked as for component storages, but there are no per-type events,
+     * groups or change tracking
+     */
+    class ArchetypeStorage
+    {
+    public:
+        using Index = Archetype::Index;
+        using TypeId = Utility::TypeId;
+
+        static constexpr Index INVALID_INDEX = Archetype::INVALID_INDEX;
+
+        /**
+         * \brief The index of the archetype without components, from which the edges of entities without components start
+         */
+        static constexpr Index ROOT_ARCHETYPE = 0;
+
+        /**
+         * \brief The position of a chunk in a list of archetypes (e.g. a query's matches)
+         */
+        struct ChunkPosition
+        {
+            Index m_archetype;
+            Index m_chunk;
+
+            bool operator==(const ChunkPosition& other) const = default;
+        };
+
+        /**
+         * \brief Creates an empty archetype storage
+         * \param scene The scene whose entities own the stored components
+         */
+        explicit ArchetypeStorage(Scene* scene = nullptr);
+
+        /**
+         * \brief Disable archetype storage copy
+         */
+        ArchetypeStorage(const ArchetypeStorage&) = delete;
+
+        /**
+         * \brief Disable archetype storage move
+         */
+        ArchetypeStorage(ArchetypeStorage&&) = delete;
+
+        /**
+         * \brief Destroys the archetype storage and its components
+         */
+        ~ArchetypeStorage() = default;
+
+        /**
+         * \brief Disable archetype storage copy
+         */
+        ArchetypeStorage& operator=(const ArchetypeStorage&) = delete;
+
+        /**
+         * \brief Disable archetype storage move
+         */
+        ArchetypeStorage& operator=(ArchetypeStorage&&) = delete;
+
+        /**
+         * \brief Checks if the given entity owns a component of the given type
+         * \tparam T The component's type
+         * \param owner The searched component's owner
+         * \return True if the entity owns a component of the given type. False otherwise
+         */
+        template <typename T>
+        bool has(Entity owner) const;
+
+        /**
+         * \brief Finds the component of the given type owned by the given entity
+         * \tparam T The component's type
+         * \param owner The searched component's owner
+         * \return A pointer to the found component on success. Nullptr otherwise
+         */
+        template <typename T>
+        T* find(Entity owner);
+
+        /**
+         * \brief Finds the component of the given type owned by the given entity
+         * \tparam T The component's type
+         * \param owner The searched component's owner
+         * \return A constant pointer to the found component on success. Nullptr otherwise
+         */
+        template <typename T>
+        const T* find(Entity owner) const;
+
+        /**
+         * \brief Assigns a copy of the given component instance to the given entity
+         * \tparam T The component's type
+         * \param owner The component's owner
+         * \param instance The assigned component instance
+         * \return A reference to the created or modified component
+         */
+        template <typename T>
+        T& set(Entity owner, const T& instance);
+
+        /**
+         * \brief Creates or replaces the given entity's component of the given type
+         * \tparam T The component's type
+         * \tparam Args The component's construction parameters
+         * \param owner The component's owner
+         * \param args The component's construction parameters
+         * \return A reference to the created or modified component
+         */
+        template <typename T, typename... Args>
+        T& construct(Entity owner, Args&&... args);
+
+        /**
+         * \brief Removes the component of the given type owned by the given entity
+         * \tparam T The component's type
+         * \param owner The removed component's owner
+         */
+        template <typename T>
+        void remove(Entity owner);
+
+        /**
+         * \brief Gets the owner of the given component instance
+         * \tparam T The component's type
+         * \param component The component instance
+         * \return The component's owner on success. NULL_ENTITY otherwise
+         */
+        template <typename T>
+        Entity getOwner(const T& component) const;
+
+        /**
+         * \brief Checks if the given entity owns at least one component in the storage
+         * \param owner The searched entity
+         * \return True if the entity owns a component in the storage. False otherwise
+         */
+        bool contains(Entity owner) const;
+
+        /**
+         * \brief Assigns copies of the source entity's components to the target entity, which must not own any component yet
+         * \param source The entity from which the components should be copied
+         * \param target The entity to which the components should be assigned
+         * \return True on success. False otherwise
+         */
+        bool copy(Entity source, Entity target);
+
+        /**
+         * \brief Assigns copies of the source entity's components to the given target entities in a single batch.\n
+         * The copies are appended to the source's archetype first, then the add hooks are invoked for each of them.
+         * Targets already owning components in the storage are skipped
+         * \param source The entity from which the components should be copied
+         * \param first A pointer to the first target entity
+         * \param last A pointer past the last target entity
+         * \return True on success. False otherwise
+         */
+        bool copyRange(Entity source, const Entity* first, const Entity* last);
+
+        /**
+         * \brief Removes all the components owned by the given entity
+         * \param owner The removed components' owner
+         */
+        void remove(Entity owner);
+
+        /**
+         * \brief Removes all stored components. Archetypes, edges and queries are kept for reuse
+         */
+        void clear();
+
+        /**
+         * \brief Gets the number of entities owning at least one component in the storage
+         * \return The number of stored entities
+         */
+        size_t getCount() const;
+
+        /**
+         * \brief Gets the number of archetypes created so far (including the root archetype)
+         * \return The number of archetypes
+         */
+        size_t getArchetypeCount() const;
+
+        /**
+         * \brief Gets the archetype at the given index
+         * \param index The archetype's index
+         * \return A reference to the archetype
+         */
+        Archetype& getArchetype(Index index);
+
+        /**
+         * \brief Gets the archetype at the given index
+         * \param index The archetype's index
+         * \return A constant reference to the archetype
+         */
+        const Archetype& getArchetype(Index index) const;
+
+        /**
+         * \brief Gets the index of the archetype holding the given entity's components
+         * \param owner The searched entity
+         * \return The entity's archetype index on success. INVALID_INDEX if it doesn't own any component in the storage
+         */
+        Index findArchetype(Entity owner) const;
+
+        /**
+         * \brief Gets the indices of the archetypes owning all the given component types.
+         * The result is cached and updated when new archetypes are created. Safe to call concurrently
+         * \param types The searched component type ids
+         * \return A reference to the matching archetypes' indices, valid for the storage's lifetime
+         */
+        const std::vector<Index>& query(std::vector<TypeId> types) const;
+
+    private:
+        struct Record
+        {
+            Index m_archetype = INVALID_INDEX;
+            Index m_row       = INVALID_INDEX;
+        };
+
+        using TypeSet = std::vector<TypeId>;
+
+        Scene*                                        m_scene;
+        std::vector<Archetype>                        m_archetypes;
+        std::map<TypeSet, Index>                      m_archetypeIds;
+        mutable std::map<TypeSet, std::vector<Index>> m_queries;
+        mutable std::mutex                            m_queryMutex;
+        std::vector<Record>                           m_records;
+        size_t                                        m_count;
+
+        /**
+         * \brief Finds the storage record of the given entity
+         * \param owner The searched entity
+         * \return A pointer to the entity's record if it owns a component in the storage. Nullptr otherwise
+         */
+        const Record* findRecord(Entity owner) const;
+
+        /**
+         * \brief Gets the storage record slot of the given entity, growing the records array if necessary
+         * \param owner The target entity
+         * \return A reference to the entity's record slot
+         */
+        Record& getRecord(Entity owner);
+
+        /**
+         * \brief Finds the component of the given type owned by the given entity
+         * \param owner The searched component's owner
+         * \param typeId The component's type id
+         * \return A pointer to the found component on success. Nullptr otherwise
+         */
+        void* findComponent(Entity owner, TypeId typeId) const;
+
+        /**
+         * \brief Gets the archetype reached by adding the given component type to the given archetype, creating it if necessary
+         * \param archetype The source archetype's index
+         * \param type The added component type
+         * \return The target archetype's index
+         */
+        Index getAddEdge(Index archetype, const Archetype::ColumnType& type);
+
+        /**
+         * \brief Gets the archetype reached by removing the given component type from the given archetype,
+         * creating it if necessary
+         * \param archetype The source archetype's index
+         * \param typeId The removed component type id
+         * \return The target archetype's index
+         */
+        Index getRemoveEdge(Index archetype, TypeId typeId);
+
+        /**
+         * \brief Finds or creates the archetype with the given component types
+         * \param columnTypes The archetype's component types
+         * \return The archetype's index
+         */
+        Index getOrCreateArchetype(std::vector<const Archetype::ColumnType*> columnTypes);
+
+        /**
+         * \brief Moves the given entity's components to the given row of the target archetype.
+         * Components missing from the target archetype are destroyed
+         * \param record The moved entity's record
+         * \param target The target archetype's index. ROOT_ARCHETYPE to remove all the entity's components
+         * \param row The entity's row in the target archetype. Ignored for the root archetype
+         */
+        void move(Record& record, Index target, Index row);
+    };
+}
+
+#include "PantheonCore/ECS/ArchetypeStorage.inl"
@@ -0,0 +1,110 @@
+#pragma once
+#include "PantheonCore/ECS/ArchetypeStorage.h"
+
+#include "PantheonCore/ECS/ComponentRegistry.h"
+#include "PantheonCore/ECS/ComponentTraits.h"
+
+namespace PantheonCore::ECS
+{
+    template <typename T>
+    bool ArchetypeStorage::has(const Entity owner) const
+    {
+        return find<T>(owner) != nullptr;
+    }
+
+    template <typename T>
+    T* ArchetypeStorage::find(const Entity owner)
+    {
+        return static_cast<T*>(findComponent(owner, ComponentRegistry::getTypeId<T>()));
+    }
+
+    template <typename T>
+    const T* ArchetypeStorage::find(const Entity owner) const
+    {
+        return static_cast<const T*>(findComponent(owner, ComponentRegistry::getTypeId<T>()));
+    }
+
+    template <typename T>
+    T& ArchetypeStorage::set(const Entity owner, const T& instance)
+    {
+        if (T* component = find<T>(owner))
+        {
+            ComponentTraits::onBeforeChange<T>({ m_scene, owner }, *component);
+            *component = instance;
+            ComponentTraits::onChange<T>({ m_scene, owner }, *component);
+
+            return *component;
+        }
+
+        return construct<T>(owner, instance);
+    }
+
+    template <typename T, typename... Args>
+    T& ArchetypeStorage::construct(const Entity owner, Args&&... args)
+    {
+        if (T* component = find<T>(owner))
+        {
+            ComponentTraits::onBeforeChange<T>({ m_scene, owner }, *component);
+            *component = T(std::forward<Args>(args)...);
+            ComponentTraits::onChange<T>({ m_scene, owner }, *component);
+
+            return *component;
+        }
+
+        const Archetype::ColumnType& type   = Archetype::ColumnType::get<T>();
+        Record&                      record = getRecord(owner);
+
+        const Index source = record.m_archetype != INVALID_INDEX ? record.m_archetype : ROOT_ARCHETYPE;
+        const Index target = getAddEdge(source, type);
+
+        // Construct the component before moving the others - the arguments may reference one of them
+        Archetype&  archetype = m_archetypes[target];
+        const Index row       = archetype.addRow(owner);
+
+        T* component = new(archetype.getComponent(row, archetype.getColumnIndex(type.m_typeId))) T(std::forward<Args>(args)...);
+        move(record, target, row);
+
+        ComponentTraits::onAdd<T>({ m_scene, owner }, *component);
+
+        return *component;
+    }
+
+    template <typename T>
+    void ArchetypeStorage::remove(const Entity owner)
+    {
+        T* component = find<T>(owner);
+
+        if (!component)
+            return;
+
+        ComponentTraits::onRemove<T>({ m_scene, owner }, *component);
+
+        // The remove hooks may have modified the entity's components - make sure the component still exists before moving
+        const TypeId typeId = ComponentRegistry::getTypeId<T>();
+
+        if (!findComponent(owner, typeId))
+            return;
+
+        Record&     record = getRecord(owner);
+        const Index target = getRemoveEdge(record.m_archetype, typeId);
+
+        move(record, target, target != ROOT_ARCHETYPE ? m_archetypes[target].addRow(owner) : INVALID_INDEX);
+    }
+
+    template <typename T>
+    Entity ArchetypeStorage::getOwner(const T& component) const
+    {
+        const TypeId typeId = ComponentRegistry::getTypeId<T>();
+
+        for (const Index index : query({ typeId }))
+        {
+            const Archetype& archetype = m_archetypes[index];
+            const Index      row       = archetype.findRow(archetype.getColumnIndex(typeId), &component);
+
+            if (row != INVALID_INDEX)
+                return archetype.getEntity(row);
+        }
+
+        return NULL_ENTITY;
+    }
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include "PantheonCore/ECS/Entity.h"
 #include "PantheonCore/Serialization/IJsonSerializable.h"
+#include "PantheonCore/Utility/TypeId.h"
 
 #include <cstdint>
 #include <memory>
@@ -34,7 +35,7 @@ namespace PantheonCore::ECS
 
         struct TypeInfo
         {
-            using TypeId = size_t;
+            using TypeId = Utility::TypeId;
 
             std::string m_name;
             TypeId      m_typeId;
@@ -82,6 +83,14 @@ namespace PantheonCore::ECS
         template <typename T>
         static const TypeInfo& getRegisteredTypeInfo();
 
+        /**
+         * \brief Gets the dense sequential id of the given component type (shared by its const variant)
+         * \tparam T The component type
+         * \return The given component type's id
+         */
+        template <typename T>
+        static TypeInfo::TypeId getTypeId();
+
         /**
          * \brief Gets the registered name for the given type id
          * \param typeId The component type's id
@@ -67,14 +67,14 @@ namespace PantheonCore::ECS
     template <typename T>
     void ComponentRegistry::registerType(const std::string& name)
     {
-        const size_t typeHash = typeid(T).hash_code();
-        ASSERT(!s_typeInfos.contains(typeHash), "Type %d (\"%s\") has already been registered", typeHash, typeid(T).name());
+        const TypeInfo::TypeId typeId = getTypeId<T>();
+        ASSERT(!s_typeInfos.contains(typeId), "Type %llu (\"%s\") has already been registered", typeId, typeid(T).name());
         ASSERT(!s_typeIds.contains(name), "Type \"%s\" has already been registered", name.c_str());
 
         const TypeInfo typeInfo
         {
             .m_name = name,
-            .m_typeId = typeHash,
+            .m_typeId = typeId,
             .makeStorage = [](Scene* scene)
             {
                 std::unique_ptr<IComponentStorage> storage = std::make_unique<ComponentStorage<T>>(scene);
@@ -82,9 +82,9 @@ namespace PantheonCore::ECS
             }
         };
 
-        s_typeInfos[typeHash] = typeInfo;
+        s_typeInfos[typeId] = typeInfo;
 
-        s_typeIds[name] = typeHash;
+        s_typeIds[name] = typeId;
     }
 
     inline const ComponentRegistry::TypeInfo& ComponentRegistry::getRegisteredTypeInfo(const std::string& type)
@@ -112,12 +112,18 @@ namespace PantheonCore::ECS
     template <typename T>
     const ComponentRegistry::TypeInfo& ComponentRegistry::getRegisteredTypeInfo()
     {
-        return getRegisteredTypeInfo(typeid(T).hash_code());
+        return getRegisteredTypeInfo(getTypeId<T>());
     }
 
     template <typename T>
     const std::string& ComponentRegistry::getRegisteredTypeName()
     {
-        return getRegisteredTypeName(typeid(T).hash_code());
+        return getRegisteredTypeName(getTypeId<T>());
+    }
+
+    template <typename T>
+    ComponentRegistry::TypeInfo::TypeId ComponentRegistry::getTypeId()
+    {
+        return Utility::TypeIdGenerator<IComponentStorage>::get<T>();
     }
 }
@@ -1,5 +1,9 @@
 #pragma once
 #include "PantheonCore/ECS/Entity.h"
+#include "PantheonCore/ECS/ISceneGroup.h"
+#include "PantheonCore/ECS/SceneSnapshot.h"
+#include "PantheonCore/ECS/SparseSet.h"
+#include "PantheonCore/ECS/Tick.h"
 #include "PantheonCore/Eventing/Event.h"
 
 #include <unordered_map>
@@ -60,6 +64,15 @@ namespace PantheonCore::ECS
          */
         virtual bool copy(Entity source, Entity target) = 0;
 
+        /**
+         * \brief Assigns copies of the source entity's component to the given target entities in a single batch
+         * \param source The entity from which the component should be copied
+         * \param first A pointer to the first target entity
+         * \param last A pointer past the last target entity
+         * \return True on success. False otherwise
+         */
+        virtual bool copyRange(Entity source, const Entity* first, const Entity* last) = 0;
+
         /**
          * \brief Removes the component owned by the given entity
          * \param owner The removed component's owner
@@ -83,6 +96,32 @@ namespace PantheonCore::ECS
          */
         virtual Entity::Id getCount() const = 0;
 
+        /**
+         * \brief Sets the tick with which modified components are stamped when change tracking is enabled
+         * \param tick The storage's new current tick
+         */
+        virtual void setTick(Tick tick) = 0;
+
+        /**
+         * \brief Gets the tick with which modified components are stamped when change tracking is enabled
+         * \return The storage's current tick
+         */
+        virtual Tick getTick() const = 0;
+
+        /**
+         * \brief Appends the storage's components, owners and change ticks to the given snapshot,
+         * starting with a factory creating an empty storage of the same type
+         * \param snapshot The target snapshot
+         */
+        virtual void toSnapshot(SceneSnapshot& snapshot) const = 0;
+
+        /**
+         * \brief Restores the storage's components, owners and change ticks from the given snapshot reader,
+         * without invoking hooks or events. The owning group (if any) is refreshed
+         * \param reader The snapshot reader, positioned right after the factory written by toSnapshot
+         */
+        virtual void fromSnapshot(SceneSnapshot::Reader& reader) = 0;
+
         /**
          * \brief Serializes the component storage to a byte array
          * \param output The output memory buffer
@@ -141,10 +180,10 @@ namespace PantheonCore::ECS
         explicit ComponentStorage(Scene* scene = nullptr);
 
         /**
-         * \brief Creates a copy of the given component storage
+         * \brief Creates a copy of the given component storage. The copy isn't owned by any group
          * \param other The component storage to copy
          */
-        ComponentStorage(const ComponentStorage& other) = default;
+        ComponentStorage(const ComponentStorage& other);
 
         /**
          * \brief Creates a move copy of the given component storage
@@ -158,11 +197,11 @@ namespace PantheonCore::ECS
         ~ComponentStorage() override = default;
 
         /**
-         * \brief Assigns a copy of the given component storage to this one
+         * \brief Assigns a copy of the given component storage to this one. The modified storage keeps (and refreshes) its owning group
          * \param other The component storage to copy
          * \return A reference to the modified component storage
          */
-        ComponentStorage& operator=(const ComponentStorage& other) = default;
+        ComponentStorage& operator=(const ComponentStorage& other);
 
         /**
          * \brief Moves the given component storage into this one
@@ -171,6 +210,20 @@ namespace PantheonCore::ECS
          */
         ComponentStorage& operator=(ComponentStorage&& other) noexcept = default;
 
+        /**
+         * \brief Gets the component stored at the given dense index
+         * \param index The target dense index
+         * \return A reference to the component stored at the given dense index
+         */
+        T& operator[](SparseSet::Index index);
+
+        /**
+         * \brief Gets the component stored at the given dense index
+         * \param index The target dense index
+         * \return A constant reference to the component stored at the given dense index
+         */
+        const T& operator[](SparseSet::Index index) const;
+
         /**
          * \brief Checks if the given entity owns a component in the storage
          * \param entity The entity to check for
@@ -186,6 +239,15 @@ namespace PantheonCore::ECS
          */
         bool copy(Entity source, Entity target) override;
 
+        /**
+         * \brief Assigns copies of the source entity's component to the given target entities in a single batch (see insertRange)
+         * \param source The entity from which the component should be copied
+         * \param first A pointer to the first target entity
+         * \param last A pointer past the last target entity
+         * \return True on success. False otherwise
+         */
+        bool copyRange(Entity source, const Entity* first, const Entity* last) override;
+
         /**
          * \brief Assigns the given component instance to the given entity
          * \param owner The component's owner
@@ -211,11 +273,37 @@ namespace PantheonCore::ECS
         void remove(Entity owner) override;
 
         /**
-         * \brief Removes the given component instance from the storage
-         * \param component The component instance to remove
+         * \brief Removes the given component instance from the storage in constant time
+         * \param component The component instance to remove. Must be a reference to one of the storage's components
          */
         void remove(const T& component);
 
+        /**
+         * \brief Assigns the given component instances to the given entities in a single batch.\n
+         * New components are appended to the dense arrays first, then the owning group and the add hooks are notified
+         * in one pass over the added entities. Entities already owning a component in the storage are updated through set()
+         * \tparam EntityIt The owners iterator's type
+         * \tparam ComponentIt The component instances iterator's type (use a move iterator to move the instances)
+         * \param first An iterator to the first owner
+         * \param last An iterator past the last owner
+         * \param components An iterator to the first owner's component instance
+         * \param dispatchHooks Whether the add hooks should be invoked for the added components
+         */
+        template <typename EntityIt, typename ComponentIt>
+        void insertRange(EntityIt first, EntityIt last, ComponentIt components, bool dispatchHooks = true);
+
+        /**
+         * \brief Removes the components owned by the given entities in a single batch.\n
+         * The remove hooks are invoked for every removed component before any of them is erased from the storage.
+         * The range is traversed twice and must not alias the storage's owners set
+         * \tparam EntityIt The owners iterator's type
+         * \param first An iterator to the first owner
+         * \param last An iterator past the last owner
+         * \param dispatchHooks Whether the remove hooks should be invoked for the removed components
+         */
+        template <typename EntityIt>
+        void removeRange(EntityIt first, EntityIt last, bool dispatchHooks = true);
+
         /**
          * \brief Removes all stored components
          */
@@ -233,6 +321,71 @@ namespace PantheonCore::ECS
          */
         Entity::Id getCount() const override;
 
+        /**
+         * \brief Sets the tick with which modified components are stamped when change tracking is enabled
+         * \param tick The storage's new current tick
+         */
+        void setTick(Tick tick) override;
+
+        /**
+         * \brief Gets the tick with which modified components are stamped when change tracking is enabled
+         * \return The storage's current tick
+         */
+        Tick getTick() const override;
+
+        /**
+         * \brief Appends the storage's components, owners and change ticks to the given snapshot,
+         * starting with a factory creating an empty storage of the same type.
+         * Trivially copyable components are copied with memcpy, others through their copy constructor
+         * \param snapshot The target snapshot
+         */
+        void toSnapshot(SceneSnapshot& snapshot) const override;
+
+        /**
+         * \brief Restores the storage's components, owners and change ticks from the given snapshot reader,
+         * without invoking hooks or events. The owning group (if any) is refreshed
+         * \param reader The snapshot reader, positioned right after the factory written by toSnapshot
+         */
+        void fromSnapshot(SceneSnapshot::Reader& reader) override;
+
+        /**
+         * \brief Enables or disables change tracking for the storage.\n
+         * When enabled, each component is stamped with the current tick whenever it is added through set, construct or
+         * insertRange, modified through set or construct, or explicitly marked as dirty.
+         * Enabling change tracking stamps all existing components with the current tick
+         * \param isEnabled Whether change tracking should be enabled or not
+         */
+        void setChangeTracking(bool isEnabled);
+
+        /**
+         * \brief Checks whether change tracking is enabled for the storage or not
+         * \return True if change tracking is enabled. False otherwise
+         */
+        bool isTrackingChanges() const;
+
+        /**
+         * \brief Stamps the component owned by the given entity with the current tick.
+         * Components modified in place (e.g. through a view) must be marked as dirty for the change to be tracked
+         * \param owner The modified component's owner
+         */
+        void markDirty(Entity owner);
+
+        /**
+         * \brief Gets the tick at which the component stored at the given dense index was last modified.
+         * Change tracking must be enabled
+         * \param index The target dense index
+         * \return The tick at which the component was last modified
+         */
+        Tick getChangeTick(SparseSet::Index index) const;
+
+        /**
+         * \brief Checks if the component owned by the given entity was modified at or after the given tick
+         * \param owner The checked component's owner
+         * \param tick The oldest tick considered as a change
+         * \return True if change tracking is enabled and the component was modified since the given tick. False otherwise
+         */
+        bool hasChangedSince(Entity owner, Tick tick) const;
+
         /**
          * \brief Checks if the given entity owns a component in the storage
          * \param owner The searched component's owner
@@ -255,12 +408,49 @@ namespace PantheonCore::ECS
         const T* find(Entity owner) const;
 
         /**
-         * \brief Gets the given component instance's owner
-         * \param component The component who's owner to find
+         * \brief Gets the given component instance's owner in constant time from its offset in the components array
+         * \param component The component who's owner to find. Must be a reference to one of the storage's components
          * \return The component's owner on success. NULL_ENTITY otherwise
          */
         Entity getOwner(const T& component) const;
 
+        /**
+         * \brief Gets the storage's packed owners set (parallel to the components array)
+         * \return A constant reference to the storage's owners set
+         */
+        const SparseSet& getOwners() const;
+
+        /**
+         * \brief Swaps the components (and owners) stored at the given dense indices
+         * \param first The first component's dense index
+         * \param second The second component's dense index
+         */
+        void swap(SparseSet::Index first, SparseSet::Index second);
+
+        /**
+         * \brief Gets the group owning the storage's order
+         * \return A pointer to the storage's owning group if any. Nullptr otherwise
+         */
+        ISceneGroup* getGroup() const;
+
+        /**
+         * \brief Sets the group owning the storage's order
+         * \param group The storage's new owning group
+         */
+        void setGroup(ISceneGroup* group);
+
+        /**
+         * \brief Gets a pointer to the packed components array
+         * \return A pointer to the packed components array
+         */
+        T* data();
+
+        /**
+         * \brief Gets a pointer to the packed components array
+         * \return A constant pointer to the packed components array
+         */
+        const T* data() const;
+
         /**
          * \brief Gets an iterator to the start of the components array
          * \return An iterator to the start of the components array
@@ -317,10 +507,33 @@ namespace PantheonCore::ECS
         bool fromJson(const rapidjson::Value& json) override;
 
     private:
-        std::vector<ComponentT>                m_components;
-        std::unordered_map<Entity::Id, size_t> m_entityToComponent;
-        std::unordered_map<size_t, Entity>     m_componentToEntity;
-        Scene*                                 m_scene;
+        std::vector<ComponentT> m_components;
+        SparseSet               m_owners;
+        std::vector<Tick>       m_changeTicks;
+        Scene*                  m_scene;
+        ISceneGroup*            m_group;
+        Tick                    m_tick;
+        bool                    m_isTrackingChanges;
+
+        /**
+         * \brief Stamps the component stored at the given dense index with the current tick if change tracking is enabled
+         * \param index The modified component's dense index
+         */
+        void stamp(SparseSet::Index index);
+
+        /**
+         * \brief Registers the given entity as the owner of the last component, stamps it if change tracking is enabled
+         * and lets the owning group reorder it
+         * \param owner The added component's owner
+         * \return The added component's dense index
+         */
+        SparseSet::Index addOwner(Entity owner);
+
+        /**
+         * \brief Moves the given owner out of the owning group and erases its component from the dense arrays
+         * \param owner The removed component's owner
+         */
+        void removeOwner(Entity owner);
     };
 }
 
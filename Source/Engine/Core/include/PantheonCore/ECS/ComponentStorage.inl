@@ -4,45 +4,132 @@
 #include "PantheonCore/ECS/ComponentRegistry.h"
 #include "PantheonCore/ECS/ComponentTraits.h"
 
+#include <functional>
+#include <iterator>
+
 namespace PantheonCore::ECS
 {
     template <class T>
     ComponentStorage<T>::ComponentStorage(Scene* scene)
-        : m_scene(scene)
+        : m_scene(scene), m_group(nullptr), m_tick(0), m_isTrackingChanges(false)
+    {
+    }
+
+    template <class T>
+    ComponentStorage<T>::ComponentStorage(const ComponentStorage& other)
+        : IComponentStorage(other), m_onAdd(other.m_onAdd), m_onRemove(other.m_onRemove), m_onBeforeChange(other.m_onBeforeChange),
+        m_onChange(other.m_onChange), m_components(other.m_components), m_owners(other.m_owners),
+        m_changeTicks(other.m_changeTicks), m_scene(other.m_scene), m_group(nullptr), m_tick(other.m_tick),
+        m_isTrackingChanges(other.m_isTrackingChanges)
     {
     }
 
+    template <class T>
+    ComponentStorage<T>& ComponentStorage<T>::operator=(const ComponentStorage& other)
+    {
+        if (&other == this)
+            return *this;
+
+        IComponentStorage::operator=(other);
+
+        m_onAdd             = other.m_onAdd;
+        m_onRemove          = other.m_onRemove;
+        m_onBeforeChange    = other.m_onBeforeChange;
+        m_onChange          = other.m_onChange;
+        m_components        = other.m_components;
+        m_owners            = other.m_owners;
+        m_changeTicks       = other.m_changeTicks;
+        m_scene             = other.m_scene;
+        m_tick              = other.m_tick;
+        m_isTrackingChanges = other.m_isTrackingChanges;
+
+        if (m_group)
+        {
+            m_group->onClear();
+
+            for (const Entity owner : other.m_owners)
+                m_group->onAdd(owner);
+        }
+
+        return *this;
+    }
+
+    template <class T>
+    T& ComponentStorage<T>::operator[](const SparseSet::Index index)
+    {
+        ASSERT(index < m_components.size());
+        return m_components[index];
+    }
+
+    template <class T>
+    const T& ComponentStorage<T>::operator[](const SparseSet::Index index) const
+    {
+        ASSERT(index < m_components.size());
+        return m_components[index];
+    }
+
     template <class T>
     bool ComponentStorage<T>::contains(const Entity entity) const
     {
-        return m_entityToComponent.contains(entity);
+        return m_owners.contains(entity);
     }
 
     template <class T>
     bool ComponentStorage<T>::copy(const Entity source, const Entity target)
     {
-        const auto sourceIt = m_entityToComponent.find(source);
+        const SparseSet::Index index = m_owners.find(source);
 
-        if (sourceIt == m_entityToComponent.end())
+        if (index == SparseSet::INVALID_INDEX)
             return false;
 
-        set(target, m_components[sourceIt->second]);
+        set(target, m_components[index]);
+        return true;
+    }
+
+    template <class T>
+    bool ComponentStorage<T>::copyRange(const Entity source, const Entity* first, const Entity* last)
+    {
+        const SparseSet::Index index = m_owners.find(source);
+
+        if (index == SparseSet::INVALID_INDEX)
+            return false;
+
+        // Inserting the copies may reallocate the components array - keep the source instance aside
+        const ComponentT instance = m_components[index];
+
+        struct RepeatIterator
+        {
+            const ComponentT* m_instance;
+
+            const ComponentT& operator*() const
+            {
+                return *m_instance;
+            }
+
+            RepeatIterator& operator++()
+            {
+                return *this;
+            }
+        };
+
+        insertRange(first, last, RepeatIterator{ &instance });
         return true;
     }
 
     template <class T>
     T& ComponentStorage<T>::set(const Entity owner, const ComponentT& instance)
     {
-        const auto it = m_entityToComponent.find(owner);
+        const SparseSet::Index index = m_owners.find(owner);
 
-        if (it != m_entityToComponent.end())
+        if (index != SparseSet::INVALID_INDEX)
         {
-            ComponentT& component = m_components[it->second];
+            ComponentT& component = m_components[index];
 
             ComponentTraits::onBeforeChange<ComponentT>({ m_scene, owner }, component);
             m_onBeforeChange.invoke({ m_scene, owner }, component);
 
             component = instance;
+            stamp(index);
 
             ComponentTraits::onChange<ComponentT>({ m_scene, owner }, component);
             m_onChange.invoke({ m_scene, owner }, component);
@@ -50,11 +137,8 @@ namespace PantheonCore::ECS
             return component;
         }
 
-        ComponentT&  component = m_components.emplace_back(instance);
-        const size_t index     = m_components.size() - 1;
-
-        m_componentToEntity[index] = owner;
-        m_entityToComponent[owner] = index;
+        m_components.emplace_back(instance);
+        ComponentT& component = m_components[addOwner(owner)];
 
         ComponentTraits::onAdd<ComponentT>({ m_scene, owner }, component);
         m_onAdd.invoke({ m_scene, owner }, component);
@@ -66,27 +150,25 @@ namespace PantheonCore::ECS
     template <typename... Args>
     T& ComponentStorage<T>::construct(const Entity owner, Args&&... args)
     {
-        const auto it = m_entityToComponent.find(owner);
+        const SparseSet::Index index = m_owners.find(owner);
 
-        if (it != m_entityToComponent.end())
+        if (index != SparseSet::INVALID_INDEX)
         {
-            ComponentT& component = m_components[it->second];
+            ComponentT& component = m_components[index];
 
             ComponentTraits::onBeforeChange<ComponentT>({ m_scene, owner }, component);
             m_onBeforeChange.invoke({ m_scene, owner }, component);
 
             component = *new(&component) ComponentT(std::forward<Args>(args)...);
+            stamp(index);
 
             ComponentTraits::onChange<ComponentT>({ m_scene, owner }, component);
             m_onChange.invoke({ m_scene, owner }, component);
             return component;
         }
 
-        ComponentT&  component = m_components.emplace_back(std::forward<Args>(args)...);
-        const size_t index     = m_components.size() - 1;
-
-        m_componentToEntity[index] = owner;
-        m_entityToComponent[owner] = index;
+        m_components.emplace_back(std::forward<Args>(args)...);
+        ComponentT& component = m_components[addOwner(owner)];
 
         ComponentTraits::onAdd<ComponentT>({ m_scene, owner }, component);
         m_onAdd.invoke({ m_scene, owner }, component);
@@ -97,25 +179,19 @@ namespace PantheonCore::ECS
     template <class T>
     void ComponentStorage<T>::remove(const Entity owner)
     {
-        const auto it = m_entityToComponent.find(owner);
+        const SparseSet::Index index = m_owners.find(owner);
 
-        if (it == m_entityToComponent.end())
+        if (index == SparseSet::INVALID_INDEX)
             return;
 
-        ComponentT& component = m_components[it->second];
+        ComponentT& component = m_components[index];
 
         ComponentTraits::onRemove<ComponentT>({ m_scene, owner }, component);
         m_onRemove.invoke({ m_scene, owner }, component);
 
-        const size_t lastIndex = m_components.size() - 1;
-
-        m_componentToEntity[it->second] = m_componentToEntity[lastIndex];
-        std::swap(component, m_components[lastIndex]);
-        m_entityToComponent[m_componentToEntity[it->second]] = it->second;
-
-        m_componentToEntity.erase(lastIndex);
-        m_components.resize(lastIndex);
-        m_entityToComponent.erase(it);
+        // The remove hooks may have modified the storage - make sure the component still exists before moving it out of its group
+        if (m_owners.contains(owner))
+            removeOwner(owner);
     }
 
     template <class T>
@@ -124,18 +200,116 @@ namespace PantheonCore::ECS
         remove(getOwner(component));
     }
 
+    template <class T>
+    template <typename EntityIt, typename ComponentIt>
+    void ComponentStorage<T>::insertRange(EntityIt first, const EntityIt last, ComponentIt components, const bool dispatchHooks)
+    {
+        if constexpr (std::forward_iterator<EntityIt>)
+            reserve(static_cast<Entity::Id>(m_components.size() + static_cast<size_t>(std::distance(first, last))));
+
+        const size_t firstAdded = m_components.size();
+
+        for (; first != last; ++first, ++components)
+        {
+            const Entity           owner = *first;
+            const SparseSet::Index index = m_owners.find(owner);
+
+            if (index == SparseSet::INVALID_INDEX)
+            {
+                m_components.emplace_back(*components);
+                m_owners.insert(owner);
+
+                if (m_isTrackingChanges)
+                    m_changeTicks.push_back(m_tick);
+            }
+            else if (index >= firstAdded)
+            {
+                // Duplicate owner in the batch - its hooks haven't been invoked yet so simply overwrite the pending component
+                m_components[index] = *components;
+            }
+            else
+            {
+                set(owner, *components);
+            }
+        }
+
+        if (m_components.size() <= firstAdded || (!m_group && !dispatchHooks))
+            return;
+
+        // The group and the hooks may reorder the storage - keep track of the added owners instead of their dense indices
+        const std::vector<Entity> added(m_owners.begin() + static_cast<std::ptrdiff_t>(firstAdded), m_owners.end());
+
+        if (m_group)
+        {
+            for (const Entity owner : added)
+                m_group->onAdd(owner);
+        }
+
+        if (!dispatchHooks)
+            return;
+
+        for (const Entity owner : added)
+        {
+            const SparseSet::Index index = m_owners.find(owner);
+
+            if (index == SparseSet::INVALID_INDEX)
+                continue;
+
+            ComponentT& component = m_components[index];
+
+            ComponentTraits::onAdd<ComponentT>({ m_scene, owner }, component);
+            m_onAdd.invoke({ m_scene, owner }, component);
+        }
+    }
+
+    template <class T>
+    template <typename EntityIt>
+    void ComponentStorage<T>::removeRange(const EntityIt first, const EntityIt last, const bool dispatchHooks)
+    {
+        if (dispatchHooks)
+        {
+            for (EntityIt it = first; it != last; ++it)
+            {
+                const Entity           owner = *it;
+                const SparseSet::Index index = m_owners.find(owner);
+
+                if (index == SparseSet::INVALID_INDEX)
+                    continue;
+
+                ComponentT& component = m_components[index];
+
+                ComponentTraits::onRemove<ComponentT>({ m_scene, owner }, component);
+                m_onRemove.invoke({ m_scene, owner }, component);
+            }
+        }
+
+        for (EntityIt it = first; it != last; ++it)
+        {
+            // The remove hooks may have modified the storage - skip the components that no longer exist
+            if (m_owners.contains(*it))
+                removeOwner(*it);
+        }
+    }
+
     template <class T>
     void ComponentStorage<T>::clear()
     {
         m_components.clear();
-        m_componentToEntity.clear();
-        m_entityToComponent.clear();
+        m_owners.clear();
+        m_changeTicks.clear();
+
+        if (m_group)
+            m_group->onClear();
     }
 
     template <class T>
     void ComponentStorage<T>::reserve(const Entity::Id count)
     {
         m_components.reserve(count);
+        m_owners.reserve(count);
+
+        if (m_isTrackingChanges)
+            m_changeTicks.reserve(count);
     }
 
     template <class T>
@@ -144,41 +318,231 @@ namespace PantheonCore::ECS
         return static_cast<Entity::Id>(m_components.size());
     }
 
+    template <class T>
+    void ComponentStorage<T>::setTick(const Tick tick)
+    {
+        m_tick = tick;
+    }
+
+    template <class T>
+    Tick ComponentStorage<T>::getTick() const
+    {
+        return m_tick;
+    }
+
+    template <class T>
+    void ComponentStorage<T>::toSnapshot(SceneSnapshot& snapshot) const
+    {
+        constexpr SceneSnapshot::StorageFactory makeStorage = [](Scene* scene) -> std::unique_ptr<IComponentStorage>
+        {
+            return std::make_unique<ComponentStorage>(scene);
+        };
+
+        snapshot.write(makeStorage);
+        snapshot.write(m_components.data(), m_components.size());
+        snapshot.write(m_owners.data(), m_owners.size());
+        snapshot.write(m_changeTicks.data(), m_changeTicks.size());
+        snapshot.write(m_tick);
+        snapshot.write(m_isTrackingChanges);
+    }
+
+    template <class T>
+    void ComponentStorage<T>::fromSnapshot(SceneSnapshot::Reader& reader)
+    {
+        // Vectors of trivially copyable types are assigned with a memmove
+        const std::span<const ComponentT> components  = reader.read<ComponentT>();
+        const std::span<const Entity>     owners      = reader.read<Entity>();
+        const std::span<const Tick>       changeTicks = reader.read<Tick>();
+
+        m_components.assign(components.begin(), components.end());
+        m_owners.assign(owners.data(), owners.size());
+        m_changeTicks.assign(changeTicks.begin(), changeTicks.end());
+
+        m_tick              = reader.readValue<Tick>();
+        m_isTrackingChanges = reader.readValue<bool>();
+
+        if (m_group)
+        {
+            m_group->onClear();
+
+            for (const Entity owner : m_owners)
+                m_group->onAdd(owner);
+        }
+    }
+
+    template <class T>
+    void ComponentStorage<T>::setChangeTracking(const bool isEnabled)
+    {
+        if (isEnabled == m_isTrackingChanges)
+            return;
+
+        m_isTrackingChanges = isEnabled;
+
+        if (isEnabled)
+        {
+            m_changeTicks.reserve(m_components.capacity());
+            m_changeTicks.assign(m_components.size(), m_tick);
+        }
+        else
+        {
+            m_changeTicks.clear();
+            m_changeTicks.shrink_to_fit();
+        }
+    }
+
+    template <class T>
+    bool ComponentStorage<T>::isTrackingChanges() const
+    {
+        return m_isTrackingChanges;
+    }
+
+    template <class T>
+    void ComponentStorage<T>::markDirty(const Entity owner)
+    {
+        const SparseSet::Index index = m_owners.find(owner);
+
+        if (index != SparseSet::INVALID_INDEX)
+            stamp(index);
+    }
+
+    template <class T>
+    Tick ComponentStorage<T>::getChangeTick(const SparseSet::Index index) const
+    {
+        ASSERT(m_isTrackingChanges, "Unable to get component change tick - Change tracking is disabled");
+        ASSERT(index < m_changeTicks.size());
+        return m_changeTicks[index];
+    }
+
+    template <class T>
+    bool ComponentStorage<T>::hasChangedSince(const Entity owner, const Tick tick) const
+    {
+        if (!m_isTrackingChanges)
+            return false;
+
+        const SparseSet::Index index = m_owners.find(owner);
+        return index != SparseSet::INVALID_INDEX && m_changeTicks[index] >= tick;
+    }
+
     template <class T>
     bool ComponentStorage<T>::has(const Entity owner) const
     {
-        return m_entityToComponent.contains(owner);
+        return m_owners.contains(owner);
     }
 
     template <class T>
     T* ComponentStorage<T>::find(const Entity owner)
     {
-        const auto it = m_entityToComponent.find(owner);
-        return it != m_entityToComponent.end() ? &m_components[it->second] : nullptr;
+        const SparseSet::Index index = m_owners.find(owner);
+        return index != SparseSet::INVALID_INDEX ? &m_components[index] : nullptr;
     }
 
     template <class T>
     const T* ComponentStorage<T>::find(const Entity owner) const
     {
-        const auto it = m_entityToComponent.find(owner);
-        return it != m_entityToComponent.end() ? &m_components[it->second] : nullptr;
+        const SparseSet::Index index = m_owners.find(owner);
+        return index != SparseSet::INVALID_INDEX ? &m_components[index] : nullptr;
     }
 
     template <class T>
     Entity ComponentStorage<T>::getOwner(const T& component) const
     {
-        size_t index = 0;
+        const ComponentT* first   = m_components.data();
+        const ComponentT* address = &component;
 
-        while (index < m_components.size())
-        {
-            if (&m_components[index] == &component)
-                break;
+        // Raw pointer comparisons between unrelated objects are unspecified - std::less guarantees a total order
+        const bool isInStorage = !std::less<const ComponentT*>()(address, first)
+            && std::less<const ComponentT*>()(address, first + m_components.size());
+
+        if (!CHECK(isInStorage, "Unable to find component owner - The component doesn't belong to this storage"))
+            return NULL_ENTITY;
 
-            ++index;
+        return m_owners[static_cast<SparseSet::Index>(address - first)];
+    }
+
+    template <class T>
+    const SparseSet& ComponentStorage<T>::getOwners() const
+    {
+        return m_owners;
+    }
+
+    template <class T>
+    void ComponentStorage<T>::swap(const SparseSet::Index first, const SparseSet::Index second)
+    {
+        if (first == second)
+            return;
+
+        std::swap(m_components[first], m_components[second]);
+        m_owners.swap(first, second);
+
+        if (m_isTrackingChanges)
+            std::swap(m_changeTicks[first], m_changeTicks[second]);
+    }
+
+    template <class T>
+    ISceneGroup* ComponentStorage<T>::getGroup() const
+    {
+        return m_group;
+    }
+
+    template <class T>
+    void ComponentStorage<T>::setGroup(ISceneGroup* group)
+    {
+        m_group = group;
+    }
+
+    template <class T>
+    T* ComponentStorage<T>::data()
+    {
+        return m_components.data();
+    }
+
+    template <class T>
+    const T* ComponentStorage<T>::data() const
+    {
+        return m_components.data();
+    }
+
+    template <class T>
+    SparseSet::Index ComponentStorage<T>::addOwner(const Entity owner)
+    {
+        const SparseSet::Index index = m_owners.insert(owner);
+
+        if (m_isTrackingChanges)
+            m_changeTicks.push_back(m_tick);
+
+        if (!m_group)
+            return index;
+
+        m_group->onAdd(owner);
+        return m_owners.find(owner);
+    }
+
+    template <class T>
+    void ComponentStorage<T>::removeOwner(const Entity owner)
+    {
+        if (m_group)
+            m_group->onRemove(owner);
+
+        const SparseSet::Index index = m_owners.find(owner);
+
+        if (index != m_components.size() - 1)
+            m_components[index] = std::move(m_components.back());
+
+        m_components.pop_back();
+        m_owners.erase(index);
+
+        if (m_isTrackingChanges)
+        {
+            m_changeTicks[index] = m_changeTicks.back();
+            m_changeTicks.pop_back();
         }
+    }
 
-        const auto it = m_componentToEntity.find(index);
-        return it != m_componentToEntity.end() ? it->second : NULL_ENTITY;
+    template <class T>
+    void ComponentStorage<T>::stamp(const SparseSet::Index index)
+    {
+        if (m_isTrackingChanges)
+            m_changeTicks[index] = m_tick;
     }
 
     template <class T>
@@ -213,9 +577,10 @@ namespace PantheonCore::ECS
 
         output.reserve(output.size() + getCount() * (sizeof(T) + sizeof(Entity::Id)));
 
-        for (const auto [index, entity] : m_componentToEntity)
+        for (size_t index = 0; index < m_owners.size(); ++index)
         {
-            const auto it = entitiesMap.find(entity);
+            const Entity entity = m_owners[index];
+            const auto   it     = entitiesMap.find(entity);
 
             if (!CHECK(it != entitiesMap.end(), "Failed to serialize component storage - Entity %d not found", entity.getIndex()))
                 return false;
@@ -244,7 +609,11 @@ namespace PantheonCore::ECS
         if (!CHECK(offset > 0, "Failed to read component storage size"))
             return 0;
 
-        reserve(count);
+        std::vector<Entity>     owners;
+        std::vector<ComponentT> components;
+
+        owners.reserve(count);
+        components.reserve(count);
 
         for (size_t i = 0; i < count; ++i)
         {
@@ -255,16 +624,17 @@ namespace PantheonCore::ECS
                 return false;
 
             offset += readBytes;
-            ComponentT component;
-            readBytes = length >= offset ? ComponentRegistry::fromBinary(component, data + offset, length - offset) : 0;
+            ComponentT& component = components.emplace_back();
+            readBytes             = length >= offset ? ComponentRegistry::fromBinary(component, data + offset, length - offset) : 0;
 
             if (readBytes == 0)
                 return false;
 
-            set(Entity(id), component);
+            owners.emplace_back(id);
             offset += readBytes;
         }
 
+        insertRange(owners.begin(), owners.end(), std::make_move_iterator(components.begin()));
         return offset;
     }
 
@@ -273,9 +643,10 @@ namespace PantheonCore::ECS
     {
         writer.StartArray();
 
-        for (const auto [index, entity] : m_componentToEntity)
+        for (size_t index = 0; index < m_owners.size(); ++index)
         {
-            const auto it = entitiesMap.find(entity);
+            const Entity entity = m_owners[index];
+            const auto   it     = entitiesMap.find(entity);
 
             if (!CHECK(it != entitiesMap.end(), "Failed to serialize component storage - Entity %d not found", entity.getIndex()))
                 return false;
@@ -302,6 +673,12 @@ namespace PantheonCore::ECS
         if (!CHECK(json.IsArray(), "Failed to deserialize component storage - Json value should be an array"))
             return false;
 
+        std::vector<Entity>     owners;
+        std::vector<ComponentT> components;
+
+        owners.reserve(json.Size());
+        components.reserve(json.Size());
+
         for (const auto& jsonComponent : json.GetArray())
         {
             if (!CHECK(jsonComponent.IsObject(), "Failed to deserialize storage component - Json value should be an object"))
@@ -319,13 +696,13 @@ namespace PantheonCore::ECS
             if (!CHECK(it != jsonComponent.MemberEnd(), "Failed to read component"))
                 return false;
 
-            ComponentT component;
-            if (!ComponentRegistry::fromJson(component, it->value))
+            if (!ComponentRegistry::fromJson(components.emplace_back(), it->value))
                 return false;
 
-            set(owner, component);
+            owners.push_back(owner);
         }
 
+        insertRange(owners.begin(), owners.end(), std::make_move_iterator(components.begin()));
         return true;
     }
 }
@@ -4,6 +4,14 @@ namespace PantheonCore::ECS
 {
     class EntityHandle;
 
+    /**
+     * \brief Whether components of the given type are always kept in a component storage, including in archetype scenes.
+     * Required for the component types whose storage is used directly (e.g. through its events, groups or change tracking)
+     * \tparam T The component type
+     */
+    template <class T>
+    inline constexpr bool IsSparseComponent = false;
+
     struct ComponentTraits
     {
         /**
@@ -7,6 +7,8 @@
 
 namespace PantheonCore::ECS
 {
+    class Scene;
+
     class HierarchyComponent
     {
     public:
@@ -86,6 +88,7 @@ namespace PantheonCore::ECS
     private:
         friend struct ComponentTraits;
         friend class ComponentRegistry;
+        friend void CloneHierarchies(Scene&, const std::vector<Entity>&, const Entity*, size_t);
 
         Entity m_parent          = NULL_ENTITY;
         Entity m_firstChild      = NULL_ENTITY;
@@ -94,6 +97,11 @@ namespace PantheonCore::ECS
         size_t m_childCount      = 0;
     };
 
+    /**
+     * \brief Gets the transforms linked to this entity (i.e. the closest transforms among its descendants)
+     * \param entity The entity for which the linked transforms should be found
+     * \return The transforms linked to the entity
+     */
     std::vector<LibMath::Transform*> GetChildTransforms(EntityHandle entity);
 
     /**
@@ -108,6 +116,23 @@ namespace PantheonCore::ECS
      */
     void UnlinkTransforms(EntityHandle entity);
 
+    /**
+     * \brief Assigns copies of the given subtree's hierarchy components to the given instances in a single batch.
+     * The copies' entity references are remapped to the matching instances, so each instance gets its own copy of the subtree
+     * and the copies of the subtree's root don't have a parent or siblings
+     * \param scene The subtree's scene
+     * \param subtree The subtree's entities in depth-first order, starting with its root
+     * \param instances The instances, grouped by subtree entity (i.e. the copies of the i-th subtree entity start at i * count)
+     * \param count The number of instances of each subtree entity
+     */
+    void CloneHierarchies(Scene& scene, const std::vector<Entity>& subtree, const Entity* instances, size_t count);
+
+    template <>
+    inline constexpr bool IsSparseComponent<HierarchyComponent> = true;
+
+    template <>
+    inline constexpr bool IsSparseComponent<LibMath::Transform> = true;
+
     template <>
     void ComponentTraits::onAdd<HierarchyComponent>(EntityHandle, HierarchyComponent&);
 
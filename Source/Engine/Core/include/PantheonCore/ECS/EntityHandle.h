@@ -1,5 +1,8 @@
 #pragma once
 #include "PantheonCore/ECS/Entity.h"
+#include "PantheonCore/ECS/HierarchyIterator.h"
+
+#include <vector>
 
 namespace PantheonCore::ECS
 {
@@ -15,6 +18,13 @@ namespace PantheonCore::ECS
             CHILDREN
         };
 
+        enum class EVisitResult
+        {
+            CONTINUE,
+            SKIP_CHILDREN,
+            STOP
+        };
+
         /**
          * \brief Creates a handle for the given entity
          * \param scene The linked entity's scene
@@ -94,6 +104,12 @@ namespace PantheonCore::ECS
          */
         void setParent(EntityHandle parent);
 
+        /**
+         * \brief Gets the entity's first child
+         * \return A handle to the entity's first child if found or to NULL_ENTITY otherwise
+         */
+        EntityHandle getFirstChild() const;
+
         /**
          * \brief Gets the entity's next sibling
          * \return A handle to the entity's next sibling if found or to NULL_ENTITY otherwise
@@ -120,11 +136,53 @@ namespace PantheonCore::ECS
         EntityHandle getChild(size_t index) const;
 
         /**
-         * \brief Gets the entity's children
+         * \brief Gets the entity's children. Prefer children() to iterate without allocating
          * \return A vector of the entity's children
          */
         std::vector<EntityHandle> getChildren() const;
 
+        /**
+         * \brief Gets a range over the entity's children, following the hierarchy's sibling links
+         * \return A range over the entity's children
+         */
+        HierarchyRange children() const;
+
+        /**
+         * \brief Gets a range over the entity's ancestors, from its parent to the root of its hierarchy
+         * \return A range over the entity's ancestors
+         */
+        HierarchyRange ancestors() const;
+
+        /**
+         * \brief Visits the entity and its descendants in depth-first order (parents before their children) without
+         * allocating. The hierarchy must not be modified during the visit
+         * \tparam Func The visitor's type. Takes an EntityHandle and returns either void or an EVisitResult
+         * \param func The visitor to call for each entity
+         * \return False if the visit was stopped by the visitor. True otherwise
+         */
+        template <typename Func>
+        bool visitDepthFirst(Func&& func) const;
+
+        /**
+         * \brief Visits the entity and its descendants level by level. The queue is kept in a per-thread buffer reused
+         * across visits. The hierarchy must not be modified during the visit
+         * \tparam Func The visitor's type. Takes an EntityHandle and returns either void or an EVisitResult
+         * \param func The visitor to call for each entity
+         * \return False if the visit was stopped by the visitor. True otherwise
+         */
+        template <typename Func>
+        bool visitBreadthFirst(Func&& func) const;
+
+        /**
+         * \brief Visits the entity's descendants then the entity itself, children before their parents, without
+         * allocating. The next entity is found before calling the visitor, which can therefore destroy the visited entity
+         * \tparam Func The visitor's type. Takes an EntityHandle and returns either void or an EVisitResult
+         * \param func The visitor to call for each entity
+         * \return False if the visit was stopped by the visitor. True otherwise
+         */
+        template <typename Func>
+        bool visitPostOrder(Func&& func) const;
+
         /**
          * \brief Creates a copy of the linked component
          * \return A handle to the entity's copy
@@ -247,6 +305,21 @@ namespace PantheonCore::ECS
     private:
         Scene* m_scene;
         Entity m_entity;
+
+        /**
+         * \brief Calls the given visitor for the given entity
+         * \param func The visitor to call
+         * \param entity The visited entity
+         * \return The visitor's result or CONTINUE for visitors without a result
+         */
+        template <typename Func>
+        static EVisitResult visit(Func& func, EntityHandle entity);
+
+        /**
+         * \brief Gets the calling thread's breadth-first traversal queue
+         * \return The calling thread's traversal queue
+         */
+        static std::vector<Entity>& getTraversalQueue();
     };
 }
 
@@ -2,6 +2,8 @@
 #include "PantheonCore/ECS/EntityHandle.h"
 #include "PantheonCore/ECS/Scene.h"
 
+#include <type_traits>
+
 namespace PantheonCore::ECS
 {
     template <typename T>
@@ -28,14 +30,10 @@ namespace PantheonCore::ECS
         if (T* component = get<T>())
             return component;
 
-        EntityHandle parent = getParent();
-
-        while (parent)
+        for (EntityHandle ancestor : ancestors())
         {
-            if (T* component = parent.getInParent<T>())
+            if (T* component = ancestor.get<T>())
                 return component;
-
-            parent = parent.getParent();
         }
 
         return nullptr;
@@ -47,14 +45,10 @@ namespace PantheonCore::ECS
         if (const T* component = get<T>())
             return component;
 
-        EntityHandle parent = getParent();
-
-        while (parent)
+        for (const EntityHandle ancestor : ancestors())
         {
-            if (const T* component = parent.getInParent<T>())
+            if (const T* component = ancestor.get<T>())
                 return component;
-
-            parent = parent.getParent();
         }
 
         return nullptr;
@@ -63,35 +57,136 @@ namespace PantheonCore::ECS
     template <typename T>
     T* EntityHandle::getInChildren()
     {
-        if (T* component = get<T>())
-            return component;
-
-        const std::vector<EntityHandle> children = getChildren();
+        T* found = nullptr;
 
-        for (const EntityHandle& child : children)
+        visitDepthFirst([&found](EntityHandle entity)
         {
-            if (T* component = child.getInChildren<T>())
-                return component;
-        }
+            found = entity.get<T>();
+            return found ? EVisitResult::STOP : EVisitResult::CONTINUE;
+        });
 
-        return nullptr;
+        return found;
     }
 
     template <typename T>
     const T* EntityHandle::getInChildren() const
     {
-        if (const T* component = get<T>())
-            return component;
+        const T* found = nullptr;
+
+        visitDepthFirst([&found](const EntityHandle entity)
+        {
+            found = entity.get<T>();
+            return found ? EVisitResult::STOP : EVisitResult::CONTINUE;
+        });
 
-        const std::vector<EntityHandle> children = getChildren();
+        return found;
+    }
+
+    template <typename Func>
+    bool EntityHandle::visitDepthFirst(Func&& func) const
+    {
+        if (!*this)
+            return true;
+
+        EntityHandle current = *this;
 
-        for (const EntityHandle& child : children)
+        while (current.m_entity != NULL_ENTITY)
         {
-            if (const T* component = child.getInChildren<T>())
-                return component;
+            const EVisitResult result = visit(func, current);
+
+            if (result == EVisitResult::STOP)
+                return false;
+
+            Entity next = result == EVisitResult::SKIP_CHILDREN ? NULL_ENTITY : current.getFirstChild().m_entity;
+
+            // Climb back up until an unvisited sibling is found, without leaving the visited subtree
+            while (next == NULL_ENTITY && current.m_entity != m_entity && current.m_entity != NULL_ENTITY)
+            {
+                next = current.getNextSibling().m_entity;
+
+                if (next == NULL_ENTITY)
+                    current = current.getParent();
+            }
+
+            current.m_entity = next;
         }
 
-        return nullptr;
+        return true;
+    }
+
+    template <typename Func>
+    bool EntityHandle::visitBreadthFirst(Func&& func) const
+    {
+        if (!*this)
+            return true;
+
+        // Nested visits append after the current one's entries and restore the queue's size when they're done
+        std::vector<Entity>& queue = getTraversalQueue();
+        const size_t         base  = queue.size();
+
+        queue.push_back(m_entity);
+
+        bool isComplete = true;
+
+        for (size_t i = base; i < queue.size(); ++i)
+        {
+            const EntityHandle entity(m_scene, queue[i]);
+            const EVisitResult result = visit(func, entity);
+
+            if (result == EVisitResult::STOP)
+            {
+                isComplete = false;
+                break;
+            }
+
+            if (result == EVisitResult::SKIP_CHILDREN)
+                continue;
+
+            for (const EntityHandle child : entity.children())
+                queue.push_back(child.m_entity);
+        }
+
+        queue.resize(base);
+        return isComplete;
+    }
+
+    template <typename Func>
+    bool EntityHandle::visitPostOrder(Func&& func) const
+    {
+        if (!*this)
+            return true;
+
+        EntityHandle current = *this;
+
+        for (EntityHandle child = current.getFirstChild(); child.m_entity != NULL_ENTITY; child = child.getFirstChild())
+            current = child;
+
+        while (current.m_entity != NULL_ENTITY)
+        {
+            EntityHandle next;
+
+            if (current.m_entity != m_entity)
+            {
+                next = current.getNextSibling();
+
+                if (next.m_entity != NULL_ENTITY)
+                {
+                    for (EntityHandle child = next.getFirstChild(); child.m_entity != NULL_ENTITY; child = child.getFirstChild())
+                        next = child;
+                }
+                else
+                {
+                    next = current.getParent();
+                }
+            }
+
+            if (visit(func, current) == EVisitResult::STOP)
+                return false;
+
+            current = next;
+        }
+
+        return true;
     }
 
     template <typename T>
@@ -179,4 +274,18 @@ namespace PantheonCore::ECS
         if (m_scene)
             m_scene->remove<T>(instance);
     }
+
+    template <typename Func>
+    EntityHandle::EVisitResult EntityHandle::visit(Func& func, const EntityHandle entity)
+    {
+        if constexpr (std::is_void_v<std::invoke_result_t<Func&, EntityHandle>>)
+        {
+            func(entity);
+            return EVisitResult::CONTINUE;
+        }
+        else
+        {
+            return func(entity);
+        }
+    }
 }
@@ -1,5 +1,6 @@
 #pragma once
 #include "PantheonCore/ECS/Entity.h"
+#include "PantheonCore/ECS/SceneSnapshot.h"
 #include "PantheonCore/Eventing/Event.h"
 
 namespace PantheonCore::ECS
@@ -10,8 +11,79 @@ namespace PantheonCore::ECS
     class EntityStorage
     {
     public:
-        using iterator = std::vector<Entity>::iterator;
-        using const_iterator = std::vector<Entity>::const_iterator;
+        class Iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = Entity;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const Entity*;
+            using reference = const Entity&;
+
+            /**
+             * \brief Creates a default entity storage iterator
+             */
+            Iterator() = default;
+
+            /**
+             * \brief Creates an iterator over the alive entities of the given entity table
+             * \param current The iterator's start position
+             * \param first The first slot of the entity table
+             * \param last The end of the entity table
+             */
+            Iterator(const Entity* current, const Entity* first, const Entity* last);
+
+            /**
+             * \brief Checks if the given iterator is equal to this one
+             * \param other The iterator to compare against
+             * \return True if the iterators are equal. False otherwise
+             */
+            bool operator==(const Iterator& other) const;
+
+            /**
+             * \brief Checks if the given iterator is not equal to this one
+             * \param other The iterator to compare against
+             * \return True if the iterators are not equal. False otherwise
+             */
+            bool operator!=(const Iterator& other) const;
+
+            /**
+             * \brief Dereferences the iterator
+             * \return A reference to the iterated entity
+             */
+            reference operator*() const;
+
+            /**
+             * \brief Dereferences the iterator
+             * \return A pointer to the iterated entity
+             */
+            pointer operator->() const;
+
+            /**
+             * \brief Pre-increments the iterator
+             * \return A reference to the incremented iterator
+             */
+            Iterator& operator++();
+
+            /**
+             * \brief Post-increments the iterator
+             * \return A copy of the iterator before the increment
+             */
+            Iterator operator++(int);
+
+        private:
+            const Entity* m_current = nullptr;
+            const Entity* m_first   = nullptr;
+            const Entity* m_last    = nullptr;
+
+            /**
+             * \brief Moves the iterator to the next alive entity, starting from the current slot
+             */
+            void skipDead();
+        };
+
+        using iterator = Iterator;
+        using const_iterator = Iterator;
 
         Eventing::Event<EntityHandle> m_onAdd;
         Eventing::Event<EntityHandle> m_onRemove;
@@ -60,7 +132,7 @@ namespace PantheonCore::ECS
         Entity add();
 
         /**
-         * \brief Removes the given entity from the manager
+         * \brief Removes the given entity from the manager and recycles its slot
          * \param entity The entity to remove
          */
         void remove(Entity entity);
@@ -83,6 +155,18 @@ namespace PantheonCore::ECS
          */
         void reserve(size_t count);
 
+        /**
+         * \brief Appends the manager's entity slots and free list to the given snapshot
+         * \param snapshot The target snapshot
+         */
+        void toSnapshot(SceneSnapshot& snapshot) const;
+
+        /**
+         * \brief Restores the manager's entity slots and free list from the given snapshot reader, without invoking events
+         * \param reader The snapshot reader, positioned at the data written by toSnapshot
+         */
+        void fromSnapshot(SceneSnapshot::Reader& reader);
+
         /**
          * \brief Gets an iterator to the start of the entities array
          * \return An iterator to the start of the entities array
@@ -115,7 +199,10 @@ namespace PantheonCore::ECS
 
     private:
         std::vector<Entity> m_entities;
-        Entity::Id          m_count = 0;
-        Scene*              m_scene = nullptr;
+        Entity::Id          m_freeList = Entity::INDEX_MASK;
+        Entity::Id          m_count    = 0;
+        Scene*              m_scene    = nullptr;
     };
 }
+
+#include "PantheonCore/ECS/EntityStorage.inl"
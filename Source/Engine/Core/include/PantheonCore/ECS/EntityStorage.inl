@@ -0,0 +1,58 @@
+#pragma once
+#include "PantheonCore/ECS/EntityStorage.h"
+
+namespace PantheonCore::ECS
+{
+    inline EntityStorage::Iterator::Iterator(const Entity* current, const Entity* first, const Entity* last)
+        : m_current(current), m_first(first), m_last(last)
+    {
+        skipDead();
+    }
+
+    inline bool EntityStorage::Iterator::operator==(const Iterator& other) const
+    {
+        return m_current == other.m_current;
+    }
+
+    inline bool EntityStorage::Iterator::operator!=(const Iterator& other) const
+    {
+        return !(*this == other);
+    }
+
+    inline EntityStorage::Iterator::reference EntityStorage::Iterator::operator*() const
+    {
+        return *m_current;
+    }
+
+    inline EntityStorage::Iterator::pointer EntityStorage::Iterator::operator->() const
+    {
+        return m_current;
+    }
+
+    inline EntityStorage::Iterator& EntityStorage::Iterator::operator++()
+    {
+        ++m_current;
+        skipDead();
+
+        return *this;
+    }
+
+    inline EntityStorage::Iterator EntityStorage::Iterator::operator++(int)
+    {
+        Iterator tmp = *this;
+        ++(*this);
+        return tmp;
+    }
+
+    inline void EntityStorage::Iterator::skipDead()
+    {
+        while (m_current != m_last && m_current->getIndex() != static_cast<Entity::Id>(m_current - m_first))
+            ++m_current;
+    }
+
+    inline bool EntityStorage::has(const Entity entity) const
+    {
+        const Entity::Id index = entity.getIndex();
+        return index < m_entities.size() && m_entities[index] == entity;
+    }
+}
@@ -0,0 +1,151 @@
+#pragma once
+#include "PantheonCore/ECS/Entity.h"
+
+#include <cstddef>
+#include <iterator>
+
+namespace PantheonCore::ECS
+{
+    class EntityHandle;
+    class HierarchyComponent;
+    class Scene;
+
+    template <class T>
+    class ComponentStorage;
+
+    /**
+     * \brief Iterates over an entity hierarchy by following one of the intrusive links of its hierarchy components,
+     * without any allocation. Modifying the followed link of the current entity invalidates the iterator
+     */
+    class HierarchyIterator
+    {
+    public:
+        enum class ELink
+        {
+            NEXT_SIBLING,
+            PARENT
+        };
+
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = EntityHandle;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = EntityHandle;
+
+        /**
+         * \brief Creates a default (end) hierarchy iterator
+         */
+        HierarchyIterator() = default;
+
+        /**
+         * \brief Creates a hierarchy iterator starting at the given entity
+         * \param scene The iterated entities' scene
+         * \param current The first iterated entity. NULL_ENTITY for an end iterator
+         * \param link The hierarchy link to follow when incrementing the iterator
+         */
+        HierarchyIterator(Scene* scene, Entity current, ELink link);
+
+        /**
+         * \brief Creates a copy of the given hierarchy iterator
+         * \param other The hierarchy iterator to copy
+         */
+        HierarchyIterator(const HierarchyIterator& other) = default;
+
+        /**
+         * \brief Creates a move copy of the given hierarchy iterator
+         * \param other The hierarchy iterator to move
+         */
+        HierarchyIterator(HierarchyIterator&& other) noexcept = default;
+
+        /**
+         * \brief Destroys the hierarchy iterator
+         */
+        ~HierarchyIterator() = default;
+
+        /**
+         * \brief Assigns a copy of the given hierarchy iterator to this one
+         * \param other The hierarchy iterator to copy
+         * \return A reference to the modified iterator
+         */
+        HierarchyIterator& operator=(const HierarchyIterator& other) = default;
+
+        /**
+         * \brief Moves the given hierarchy iterator into this one
+         * \param other The hierarchy iterator to move
+         * \return A reference to the modified iterator
+         */
+        HierarchyIterator& operator=(HierarchyIterator&& other) noexcept = default;
+
+        /**
+         * \brief Gets a handle to the current entity
+         * \return A handle to the current entity
+         */
+        EntityHandle operator*() const;
+
+        /**
+         * \brief Moves the iterator to the next entity along the followed link
+         * \return A reference to the modified iterator
+         */
+        HierarchyIterator& operator++();
+
+        /**
+         * \brief Moves the iterator to the next entity along the followed link
+         * \return A copy of the iterator before the increment
+         */
+        HierarchyIterator operator++(int);
+
+        /**
+         * \brief Checks whether the given iterator points to the same entity as this one
+         * \param other The iterator to compare against
+         * \return True if both iterators point to the same entity. False otherwise
+         */
+        bool operator==(const HierarchyIterator& other) const;
+
+        /**
+         * \brief Checks whether the given iterator points to a different entity than this one
+         * \param other The iterator to compare against
+         * \return True if the iterators point to different entities. False otherwise
+         */
+        bool operator!=(const HierarchyIterator& other) const;
+
+    private:
+        Scene*                                      m_scene       = nullptr;
+        const ComponentStorage<HierarchyComponent>* m_hierarchies = nullptr;
+        Entity                                      m_current     = NULL_ENTITY;
+        ELink                                       m_link        = ELink::NEXT_SIBLING;
+    };
+
+    /**
+     * \brief A range of entities linked through their hierarchy components (e.g. an entity's children or ancestors)
+     */
+    class HierarchyRange
+    {
+    public:
+        /**
+         * \brief Creates a hierarchy range starting at the given iterator
+         * \param begin The range's first element
+         */
+        explicit HierarchyRange(HierarchyIterator begin);
+
+        /**
+         * \brief Gets an iterator to the range's first entity
+         * \return An iterator to the range's first entity
+         */
+        HierarchyIterator begin() const;
+
+        /**
+         * \brief Gets the range's end iterator
+         * \return The range's end iterator
+         */
+        HierarchyIterator end() const;
+
+        /**
+         * \brief Checks whether the range is empty or not
+         * \return True if the range is empty. False otherwise
+         */
+        bool empty() const;
+
+    private:
+        HierarchyIterator m_begin;
+    };
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include "PantheonCore/ECS/Entity.h"
+
+namespace PantheonCore::ECS
+{
+    class ISceneGroup
+    {
+    public:
+        /**
+         * \brief Creates a copy of the given scene group
+         * \param other The scene group to copy
+         */
+        ISceneGroup(const ISceneGroup& other) = delete;
+
+        /**
+         * \brief Creates a move copy of the given scene group
+         * \param other The scene group to move
+         */
+        ISceneGroup(ISceneGroup&& other) noexcept = delete;
+
+        /**
+         * \brief Destroys the scene group
+         */
+        virtual ~ISceneGroup() = default;
+
+        /**
+         * \brief Assigns a copy of the given scene group to this one
+         * \param other The scene group to copy
+         * \return A reference to the modified scene group
+         */
+        ISceneGroup& operator=(const ISceneGroup& other) = delete;
+
+        /**
+         * \brief Moves the given scene group into this one
+         * \param other The scene group to move
+         * \return A reference to the modified scene group
+         */
+        ISceneGroup& operator=(ISceneGroup&& other) noexcept = delete;
+
+        /**
+         * \brief Moves the given entity into the group if it owns all of the group's components.
+         * Called by the owned storages after a component has been added
+         * \param entity The updated entity
+         */
+        virtual void onAdd(Entity entity) = 0;
+
+        /**
+         * \brief Moves the given entity out of the group if it is part of it.
+         * Called by the owned storages before a component is removed
+         * \param entity The updated entity
+         */
+        virtual void onRemove(Entity entity) = 0;
+
+        /**
+         * \brief Empties the group. Called by the owned storages when they are cleared
+         */
+        virtual void onClear() = 0;
+
+    protected:
+        ISceneGroup() = default;
+    };
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include "PantheonCore/ECS/Entity.h"
+
+namespace PantheonCore::ECS
+{
+    class ISceneObserver
+    {
+    public:
+        /**
+         * \brief Creates a copy of the given scene observer
+         * \param other The scene observer to copy
+         */
+        ISceneObserver(const ISceneObserver& other) = delete;
+
+        /**
+         * \brief Creates a move copy of the given scene observer
+         * \param other The scene observer to move
+         */
+        ISceneObserver(ISceneObserver&& other) noexcept = delete;
+
+        /**
+         * \brief Destroys the scene observer
+         */
+        virtual ~ISceneObserver() = default;
+
+        /**
+         * \brief Assigns a copy of the given scene observer to this one
+         * \param other The scene observer to copy
+         * \return A reference to the modified scene observer
+         */
+        ISceneObserver& operator=(const ISceneObserver& other) = delete;
+
+        /**
+         * \brief Moves the given scene observer into this one
+         * \param other The scene observer to move
+         * \return A reference to the modified scene observer
+         */
+        ISceneObserver& operator=(ISceneObserver&& other) noexcept = delete;
+
+        /**
+         * \brief Rebuilds the observer's matches from its storages.
+         * Called by the scene after operations that don't invoke the storages' events (e.g. clears and snapshot restores)
+         */
+        virtual void refresh() = 0;
+
+    protected:
+        ISceneObserver() = default;
+    };
+}
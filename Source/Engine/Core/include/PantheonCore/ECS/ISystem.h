@@ -0,0 +1,62 @@
+#pragma once
+#include "PantheonCore/ECS/SceneAccess.h"
+
+namespace PantheonCore::ECS
+{
+    class Scene;
+
+    /**
+     * \brief Base class for the systems run by a SystemScheduler.\n
+     * A system declares the component types it reads and writes - the scheduler uses this declaration to run systems
+     * that don't conflict concurrently. While updating, a system must not create or destroy entities, nor add or remove
+     * components. Record such changes in a SceneCommandBuffer and flush it once the scheduler's update is done instead
+     */
+    class ISystem
+    {
+    public:
+        /**
+         * \brief Creates a default system
+         */
+        ISystem() = default;
+
+        /**
+         * \brief Creates a copy of the given system
+         */
+        ISystem(const ISystem&) = default;
+
+        /**
+         * \brief Creates a move copy of the given system
+         */
+        ISystem(ISystem&&) noexcept = default;
+
+        /**
+         * \brief Destroys the system
+         */
+        virtual ~ISystem() = default;
+
+        /**
+         * \brief Assigns a copy of the given system to this one
+         * \return A reference to the modified system
+         */
+        ISystem& operator=(const ISystem&) = default;
+
+        /**
+         * \brief Moves the given system into this one
+         * \return A reference to the modified system
+         */
+        ISystem& operator=(ISystem&&) noexcept = default;
+
+        /**
+         * \brief Gets the component types the system accesses. Called once, when the system is added to a scheduler
+         * \return The system's scene access declaration
+         */
+        virtual SceneAccess getAccess() const = 0;
+
+        /**
+         * \brief Updates the system. Can run concurrently with the systems whose access doesn't conflict with this one's
+         * \param scene The updated scene
+         * \param deltaTime The time elapsed since the last update
+         */
+        virtual void update(Scene& scene, float deltaTime) = 0;
+    };
+}
@@ -1,14 +1,28 @@
 #pragma once
 #include "PantheonCore/ECS/EntityStorage.h"
+#include "PantheonCore/ECS/Tick.h"
 #include "PantheonCore/Resources/IResource.h"
 #include "PantheonCore/Serialization/IJsonSerializable.h"
+#include "PantheonCore/Utility/TypeId.h"
+
+#include <atomic>
 
 namespace PantheonCore::ECS
 {
     template <class T>
     class ComponentStorage;
+    template <class... Owned>
+    class SceneGroup;
+    template <class Filter, class... Included>
+    class SceneObserver;
+    template <typename... T>
+    struct Exclude;
+    class ArchetypeStorage;
     class IComponentStorage;
+    class ISceneGroup;
+    class ISceneObserver;
     class EntityHandle;
+    class SceneAccess;
 
     class Scene final : public Resources::IResource, public Serialization::IJsonSerializable
     {
@@ -18,11 +32,28 @@ namespace PantheonCore::ECS
         template <typename T>
         using Storage = std::conditional_t<std::is_same_v<Entity, std::remove_const_t<T>>, EntityStorage, ComponentStorage<T>>;
 
+        /**
+         * \brief The ways a scene can store its entities' components: one component storage (sparse set) per type,
+         * or chunked tables shared by the entities owning the same set of component types (see ArchetypeStorage).
+         * Sparse components (see IsSparseComponent) are kept in component storages in both modes
+         */
+        enum class EStorageMode
+        {
+            SPARSE_SET,
+            ARCHETYPE
+        };
+
         /**
          * \brief Creates an empty scene
          */
         Scene();
 
+        /**
+         * \brief Creates an empty scene using the given component storage mode
+         * \param storageMode The scene's component storage mode
+         */
+        explicit Scene(EStorageMode storageMode);
+
         /**
          * \brief Creates a copy of the given scene
          * \param other The scene to copy
@@ -112,6 +143,17 @@ namespace PantheonCore::ECS
          */
         EntityHandle create(Entity source);
 
+        /**
+         * \brief Creates the given number of copies of the given prefab entity and of its descendants in a single batch.\n
+         * The storages used by the prefab's subtree are reserved up front and each component is copied to every instance at once.
+         * The copied hierarchy components are remapped to link each instance's entities together, and the instances' roots
+         * don't have a parent. Entity references stored in other components are copied as is
+         * \param prefab The root of the subtree to instantiate
+         * \param count The number of instances to create
+         * \return The created instances' root entities
+         */
+        std::vector<Entity> instantiate(Entity prefab, size_t count = 1);
+
         /**
          * \brief Destroys the given entity
          * \param entity The entity to destroy
@@ -130,6 +172,23 @@ namespace PantheonCore::ECS
          */
         void clear();
 
+        /**
+         * \brief Replaces the given snapshot's content with a copy of the scene's entities and components.\n
+         * Scenes storing components in archetypes can't be captured
+         * \param snapshot The target snapshot
+         * \return True on success. False otherwise
+         */
+        bool saveSnapshot(SceneSnapshot& snapshot) const;
+
+        /**
+         * \brief Restores the scene's entities and components from the given snapshot, without invoking hooks or events.\n
+         * Existing storages are reused so that groups and listeners stay valid. Storages created after the capture are cleared.
+         * Must not be called while the scene is frozen
+         * \param snapshot The snapshot to restore
+         * \return True on success. False otherwise
+         */
+        bool restoreSnapshot(const SceneSnapshot& snapshot);
+
         /**
          * \brief Checks if the given entity is in this scene
          * \param owner The searched entity
@@ -137,6 +196,19 @@ namespace PantheonCore::ECS
          */
         bool contains(Entity owner) const;
 
+        /**
+         * \brief Gets the scene's current change tracking tick
+         * \return The scene's current tick
+         */
+        Tick getTick() const;
+
+        /**
+         * \brief Advances the scene's change tracking tick (e.g. once per frame - SystemScheduler::update does so after each update).
+         * Components modified from now on are reported by change queries made with the returned tick
+         * \return The scene's new current tick
+         */
+        Tick advanceTick();
+
         /**
          * \brief Checks if the given entity owns a component of the given type
          * \tparam T The component's type
@@ -202,7 +274,43 @@ namespace PantheonCore::ECS
         void remove(const T& instance);
 
         /**
-         * \brief Gets the storage for the given type
+         * \brief Gets the scene's component storage mode
+         * \return The scene's component storage mode
+         */
+        EStorageMode getStorageMode() const;
+
+        /**
+         * \brief Checks whether components of the given type are stored in the scene's archetypes
+         * instead of a component storage
+         * \tparam T The component's type
+         * \return True if the scene stores the given component type in its archetypes. False otherwise
+         */
+        template <typename T>
+        bool isArchetypeComponent() const;
+
+        /**
+         * \brief Gets the scene's archetype storage. The scene must use the archetype storage mode
+         * \return A reference to the scene's archetype storage
+         */
+        ArchetypeStorage& getArchetypeStorage();
+
+        /**
+         * \brief Gets the scene's archetype storage. The scene must use the archetype storage mode
+         * \return A constant reference to the scene's archetype storage
+         */
+        const ArchetypeStorage& getArchetypeStorage() const;
+
+        /**
+         * \brief Stamps the given entity's component of the given type with the current tick if its storage tracks changes
+         * \tparam T The modified component's type
+         * \param owner The modified component's owner
+         */
+        template <typename T>
+        void markDirty(Entity owner);
+
+        /**
+         * \brief Gets the storage for the given type, creating it if necessary. Storages can't be created while the scene is frozen.
+         * Archetype components (see isArchetypeComponent) don't have a storage
          * \tparam T The storage content type
          * \return A reference to the storage
          */
@@ -210,18 +318,106 @@ namespace PantheonCore::ECS
         Storage<T>& getStorage();
 
         /**
-         * \brief Gets the storage for the given type
+         * \brief Gets the storage for the given type, creating it if necessary.
+         * While the scene is frozen, a shared empty storage is returned for unregistered types instead
          * \tparam T The storage's content type
          * \return A constant reference to the storage
          */
         template <typename T>
         const Storage<T>& getStorage() const;
 
+        /**
+         * \brief Creates the storages for the given component types if they don't exist yet. Archetype components are skipped
+         * \tparam T The component types for which a storage should be created
+         */
+        template <typename... T>
+        void registerStorages();
+
+        /**
+         * \brief Freezes the scene's storages for a concurrent phase.
+         * See SceneAccess for the rules to follow while the scene is frozen
+         */
+        void freeze();
+
+        /**
+         * \brief Ends the current concurrent phase. Every declared access must have been ended
+         */
+        void unfreeze();
+
+        /**
+         * \brief Checks whether the scene's storages are frozen or not
+         * \return True if the scene is frozen. False otherwise
+         */
+        bool isFrozen() const;
+
+        /**
+         * \brief Declares the start of a task accessing the scene's storages as described by the given declaration.
+         * Can be called concurrently while the scene is frozen. Debug builds assert if the access conflicts with an active one
+         * \param access The task's access declaration
+         */
+        void beginAccess(const SceneAccess& access);
+
+        /**
+         * \brief Declares the end of a task accessing the scene's storages as described by the given declaration
+         * \param access The task's access declaration (must match the one passed to beginAccess)
+         */
+        void endAccess(const SceneAccess& access);
+
+        /**
+         * \brief Gets or creates the owning group for the given component types.\n
+         * The owned storages keep the entities owning all of the group's components packed at their front, in the same order.
+         * A storage can only be owned by a single group - requesting a group overlapping an existing one with different
+         * component types (or in a different order) fails
+         * \tparam Owned The group's owned component types
+         * \return A pointer to the group on success. Nullptr if one of the storages is already owned by another group
+         */
+        template <typename... Owned>
+        SceneGroup<Owned...>* group();
+
+        /**
+         * \brief Gets or creates the observer matching the entities owning all of the given included components and none of
+         * the excluded ones (e.g. observe<Transform, Light>(Exclude<Disabled>{})).\n
+         * The observer keeps its matches up to date from the storages' add and remove events, and is refreshed by the scene
+         * after operations bypassing them (clears and snapshot restores). Observers can't be created while the scene is frozen
+         * \tparam Included The component types the matched entities must own
+         * \tparam Excluded The component types the matched entities must not own
+         * \return A reference to the observer, valid for the scene's lifetime
+         */
+        template <typename... Included, typename... Excluded>
+        SceneObserver<Exclude<Excluded...>, Included...>& observe(Exclude<Excluded...> = {});
+
     private:
-        using TypeId = size_t;
+        using TypeId = Utility::TypeId;
+
+        static constexpr int32_t WRITE_ACCESS = -1;
 
-        EntityStorage                                                          m_entities;
-        mutable std::unordered_map<TypeId, std::unique_ptr<IComponentStorage>> m_components;
+        EntityStorage                                           m_entities;
+        mutable std::vector<std::unique_ptr<IComponentStorage>> m_components;
+        std::unique_ptr<ArchetypeStorage>                       m_archetypes;
+        std::vector<std::unique_ptr<ISceneGroup>>               m_groups;
+        std::vector<std::unique_ptr<ISceneObserver>>            m_observers;
+        Tick                                                    m_tick;
+        std::vector<std::atomic<int32_t>>                       m_accessStates;
+        bool                                                    m_isFrozen;
+
+        /**
+         * \brief Gets the component storage with the given type id
+         * \param typeId The searched storage's component type id
+         * \return A pointer to the found storage on success. Nullptr otherwise
+         */
+        IComponentStorage* findStorage(TypeId typeId) const;
+
+        /**
+         * \brief Gets the storage slot for the given component type id, growing the storages array if necessary
+         * \param typeId The target component type id
+         * \return A reference to the storage slot for the given type id
+         */
+        std::unique_ptr<IComponentStorage>& getStorageSlot(TypeId typeId) const;
+
+        /**
+         * \brief Rebuilds the matches of the scene's observers after an operation bypassing the storages' events
+         */
+        void refreshObservers();
 
         /**
          * \brief Deserializes a component storage from json
@@ -1,65 +1,90 @@
 #pragma once
 #include "PantheonCore/ECS/Scene.h"
 
+#include "PantheonCore/ECS/ArchetypeStorage.h"
+#include "PantheonCore/ECS/ComponentRegistry.h"
 #include "PantheonCore/ECS/ComponentStorage.h"
+#include "PantheonCore/ECS/SceneAccess.h"
+#include "PantheonCore/ECS/SceneGroup.h"
+#include "PantheonCore/ECS/SceneObserver.h"
 
 namespace PantheonCore::ECS
 {
     template <typename T>
     bool Scene::has(Entity owner) const
     {
-        const auto it = m_components.find(typeid(T).hash_code());
+        if (isArchetypeComponent<T>())
+            return m_archetypes->has<std::remove_const_t<T>>(owner);
 
-        if (it == m_components.end())
-            return false;
-
-        return reinterpret_cast<ComponentStorage<T>*>(it->second.get())->has(owner);
+        const IComponentStorage* storage = findStorage(ComponentRegistry::getTypeId<T>());
+        return storage && reinterpret_cast<const ComponentStorage<T>*>(storage)->has(owner);
     }
 
     template <typename T>
     T* Scene::get(Entity owner)
     {
-        const auto it = m_components.find(typeid(T).hash_code());
-
-        if (it == m_components.end())
-            return nullptr;
+        if (isArchetypeComponent<T>())
+            return m_archetypes->find<std::remove_const_t<T>>(owner);
 
-        return reinterpret_cast<ComponentStorage<T>*>(it->second.get())->find(owner);
+        IComponentStorage* storage = findStorage(ComponentRegistry::getTypeId<T>());
+        return storage ? reinterpret_cast<ComponentStorage<T>*>(storage)->find(owner) : nullptr;
     }
 
     template <typename T>
     const T* Scene::get(Entity owner) const
     {
-        const auto it = m_components.find(typeid(T).hash_code());
+        if (isArchetypeComponent<T>())
+            return static_cast<const ArchetypeStorage&>(*m_archetypes).find<std::remove_const_t<T>>(owner);
 
-        if (it == m_components.end())
-            return nullptr;
-
-        return reinterpret_cast<const ComponentStorage<T>*>(it->second.get())->find(owner);
+        const IComponentStorage* storage = findStorage(ComponentRegistry::getTypeId<T>());
+        return storage ? reinterpret_cast<const ComponentStorage<T>*>(storage)->find(owner) : nullptr;
     }
 
     template <typename T>
     T& Scene::set(Entity owner, const T& instance)
     {
+        if (isArchetypeComponent<T>())
+            return m_archetypes->set<T>(owner, instance);
+
         return getStorage<T>().set(owner, instance);
     }
 
     template <typename T, typename... Args>
     T& Scene::make(Entity owner, Args&&... args)
     {
+        if (isArchetypeComponent<T>())
+            return m_archetypes->construct<T>(owner, std::forward<Args>(args)...);
+
         return getStorage<T>().construct(owner, std::forward<Args>(args)...);
     }
 
     template <typename T>
     void Scene::remove(Entity owner)
     {
-        getStorage<T>().remove(owner);
+        if (isArchetypeComponent<T>())
+            m_archetypes->remove<T>(owner);
+        else
+            getStorage<T>().remove(owner);
     }
 
     template <typename T>
     void Scene::remove(const T& instance)
     {
-        getStorage<T>().remove(instance);
+        if (isArchetypeComponent<T>())
+            m_archetypes->remove<T>(m_archetypes->getOwner(instance));
+        else
+            getStorage<T>().remove(instance);
+    }
+
+    template <typename T>
+    void Scene::markDirty(const Entity owner)
+    {
+        // Archetype components don't track changes
+        if (isArchetypeComponent<T>())
+            return;
+
+        if (IComponentStorage* storage = findStorage(ComponentRegistry::getTypeId<T>()))
+            reinterpret_cast<ComponentStorage<T>*>(storage)->markDirty(owner);
     }
 
     template <typename T>
@@ -71,14 +96,18 @@ namespace PantheonCore::ECS
         }
         else
         {
-            const TypeId typeHash = typeid(T).hash_code();
-            const auto   it       = m_components.find(typeHash);
+            ASSERT(!isArchetypeComponent<T>(), "Unable to get component storage - The component type is stored in archetypes");
+
+            std::unique_ptr<IComponentStorage>& storage = getStorageSlot(ComponentRegistry::getTypeId<T>());
 
-            if (it != m_components.end())
-                return reinterpret_cast<ComponentStorage<T>&>(*it->second);
+            if (!storage)
+            {
+                ASSERT(!m_isFrozen, "Unable to create component storage - The scene is frozen");
+                storage = std::make_unique<ComponentStorage<std::remove_const_t<T>>>(this);
+                storage->setTick(m_tick);
+            }
 
-            auto& storage = *(m_components[typeHash] = std::make_unique<ComponentStorage<T>>(this));
-            return reinterpret_cast<ComponentStorage<T>&>(storage);
+            return reinterpret_cast<ComponentStorage<T>&>(*storage);
         }
     }
 
@@ -91,14 +120,88 @@ namespace PantheonCore::ECS
         }
         else
         {
-            const TypeId typeHash = typeid(T).hash_code();
-            const auto   it       = m_components.find(typeHash);
+            ASSERT(!isArchetypeComponent<T>(), "Unable to get component storage - The component type is stored in archetypes");
+
+            const TypeId typeId = ComponentRegistry::getTypeId<T>();
 
-            if (it != m_components.end())
-                return reinterpret_cast<const ComponentStorage<T>&>(*it->second);
+            if (const IComponentStorage* existing = findStorage(typeId))
+                return reinterpret_cast<const ComponentStorage<T>&>(*existing);
 
-            const auto& storage = *(m_components[typeHash] = std::make_unique<ComponentStorage<T>>(const_cast<Scene*>(this)));
-            return reinterpret_cast<const ComponentStorage<T>&>(storage);
+            if (m_isFrozen)
+            {
+                // Storages can't be created concurrently - unregistered types are simply empty for the whole phase
+                static const ComponentStorage<std::remove_const_t<T>> empty;
+                return reinterpret_cast<const ComponentStorage<T>&>(empty);
+            }
+
+            std::unique_ptr<IComponentStorage>& storage = getStorageSlot(typeId);
+            storage = std::make_unique<ComponentStorage<std::remove_const_t<T>>>(const_cast<Scene*>(this));
+            storage->setTick(m_tick);
+
+            return reinterpret_cast<const ComponentStorage<T>&>(*storage);
         }
     }
+
+    template <typename T>
+    bool Scene::isArchetypeComponent() const
+    {
+        return !IsSparseComponent<std::remove_const_t<T>> && m_archetypes != nullptr;
+    }
+
+    template <typename... T>
+    void Scene::registerStorages()
+    {
+        ((isArchetypeComponent<T>() ? void() : void(getStorage<T>())), ...);
+    }
+
+    inline IComponentStorage* Scene::findStorage(const TypeId typeId) const
+    {
+        return typeId < m_components.size() ? m_components[typeId].get() : nullptr;
+    }
+
+    inline std::unique_ptr<IComponentStorage>& Scene::getStorageSlot(const TypeId typeId) const
+    {
+        if (typeId >= m_components.size())
+            m_components.resize(typeId + 1);
+
+        return m_components[typeId];
+    }
+
+    template <typename... Owned>
+    SceneGroup<Owned...>* Scene::group()
+    {
+        using FirstT = std::tuple_element_t<0, std::tuple<Owned...>>;
+
+        // A group of the same type owns all of its storages - any other group is an overlap
+        if (ISceneGroup* existing = getStorage<FirstT>().getGroup())
+        {
+            auto* group = dynamic_cast<SceneGroup<Owned...>*>(existing);
+            CHECK(group != nullptr, "Unable to create group - The component storages are already owned by another group");
+            return group;
+        }
+
+        if (!CHECK(((getStorage<Owned>().getGroup() == nullptr) && ...),
+            "Unable to create group - A component storage is already owned by another group"))
+            return nullptr;
+
+        auto group = std::make_unique<SceneGroup<Owned...>>(getStorage<Owned>()...);
+        return static_cast<SceneGroup<Owned...>*>(m_groups.emplace_back(std::move(group)).get());
+    }
+
+    template <typename... Included, typename... Excluded>
+    SceneObserver<Exclude<Excluded...>, Included...>& Scene::observe(Exclude<Excluded...>)
+    {
+        using ObserverT = SceneObserver<Exclude<Excluded...>, Included...>;
+
+        for (const std::unique_ptr<ISceneObserver>& observer : m_observers)
+        {
+            if (auto* existing = dynamic_cast<ObserverT*>(observer.get()))
+                return *existing;
+        }
+
+        ASSERT(!m_isFrozen, "Unable to create observer - The scene is frozen");
+
+        auto observer = std::make_unique<ObserverT>(std::tie(getStorage<Included>()...), std::tie(getStorage<Excluded>()...));
+        return static_cast<ObserverT&>(*m_observers.emplace_back(std::move(observer)));
+    }
 }
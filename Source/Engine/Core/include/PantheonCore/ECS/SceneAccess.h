@@ -0,0 +1,142 @@
+#pragma once
+#include "PantheonCore/Utility/TypeId.h"
+
+#include <vector>
+
+namespace PantheonCore::ECS
+{
+    /**
+     * \brief Declares the component types a task reads from and writes to in a scene.\n
+     * Concurrency model: a scene is not thread-safe by default. To run tasks on several threads against the same scene,
+     * register every storage they use (Scene::registerStorages), then freeze the scene for the duration of the phase
+     * (Scene::freeze). While frozen, no storage can be created, no entity can be created or destroyed and each task must
+     * declare its access through Scene::beginAccess and Scene::endAccess. Any number of tasks may read a given component
+     * type at the same time, but a written type must not be accessed by any other task. Writing a type allows modifying
+     * its components in place - structural changes (adding or removing components) should be recorded in command buffers
+     * and flushed once the scene is unfrozen. Debug builds assert on conflicting declarations
+     */
+    class SceneAccess
+    {
+    public:
+        using TypeId = Utility::TypeId;
+
+        /**
+         * \brief Creates an empty scene access declaration
+         */
+        SceneAccess() = default;
+
+        /**
+         * \brief Creates a copy of the given scene access declaration
+         * \param other The scene access declaration to copy
+         */
+        SceneAccess(const SceneAccess& other) = default;
+
+        /**
+         * \brief Creates a move copy of the given scene access declaration
+         * \param other The scene access declaration to move
+         */
+        SceneAccess(SceneAccess&& other) noexcept = default;
+
+        /**
+         * \brief Destroys the scene access declaration
+         */
+        ~SceneAccess() = default;
+
+        /**
+         * \brief Assigns a copy of the given scene access declaration to this one
+         * \param other The scene access declaration to copy
+         * \return A reference to the modified scene access declaration
+         */
+        SceneAccess& operator=(const SceneAccess& other) = default;
+
+        /**
+         * \brief Moves the given scene access declaration into this one
+         * \param other The scene access declaration to move
+         * \return A reference to the modified scene access declaration
+         */
+        SceneAccess& operator=(SceneAccess&& other) noexcept = default;
+
+        /**
+         * \brief Declares read access to the given component types. Types already declared as written are ignored
+         * \tparam T The read component types
+         * \return A reference to the modified scene access declaration
+         */
+        template <typename... T>
+        SceneAccess& read();
+
+        /**
+         * \brief Declares write access to the given component types
+         * \tparam T The written component types
+         * \return A reference to the modified scene access declaration
+         */
+        template <typename... T>
+        SceneAccess& write();
+
+        /**
+         * \brief Checks if the declaration allows reading the given component type
+         * \tparam T The checked component type
+         * \return True if the component type is read or written. False otherwise
+         */
+        template <typename T>
+        bool canRead() const;
+
+        /**
+         * \brief Checks if the declaration allows writing the given component type
+         * \tparam T The checked component type
+         * \return True if the component type is written. False otherwise
+         */
+        template <typename T>
+        bool canWrite() const;
+
+        /**
+         * \brief Checks if the declaration allows reading the component type with the given id
+         * \param typeId The checked component type id
+         * \return True if the component type is read or written. False otherwise
+         */
+        bool canRead(TypeId typeId) const;
+
+        /**
+         * \brief Checks if the declaration allows writing the component type with the given id
+         * \param typeId The checked component type id
+         * \return True if the component type is written. False otherwise
+         */
+        bool canWrite(TypeId typeId) const;
+
+        /**
+         * \brief Checks if the given declaration conflicts with this one (i.e. one of them writes a type the other accesses)
+         * \param other The scene access declaration to check against
+         * \return True if both declarations can't be used at the same time. False otherwise
+         */
+        bool conflictsWith(const SceneAccess& other) const;
+
+        /**
+         * \brief Gets the sorted ids of the read-only component types
+         * \return The read-only component type ids
+         */
+        const std::vector<TypeId>& getReads() const;
+
+        /**
+         * \brief Gets the sorted ids of the written component types
+         * \return The written component type ids
+         */
+        const std::vector<TypeId>& getWrites() const;
+
+    private:
+        std::vector<TypeId> m_reads;
+        std::vector<TypeId> m_writes;
+
+        /**
+         * \brief Declares read access to the component type with the given id
+         * \param typeId The read component type id
+         */
+        void addRead(TypeId typeId);
+
+        /**
+         * \brief Declares write access to the component type with the given id
+         * \param typeId The written component type id
+         */
+        void addWrite(TypeId typeId);
+    };
+}
+
+#include "PantheonCore/ECS/SceneAccess.inl"
@@ -0,0 +1,33 @@
+#pragma once
+#include "PantheonCore/ECS/SceneAccess.h"
+
+#include "PantheonCore/ECS/ComponentRegistry.h"
+
+namespace PantheonCore::ECS
+{
+    template <typename... T>
+    SceneAccess& SceneAccess::read()
+    {
+        (addRead(ComponentRegistry::getTypeId<T>()), ...);
+        return *this;
+    }
+
+    template <typename... T>
+    SceneAccess& SceneAccess::write()
+    {
+        (addWrite(ComponentRegistry::getTypeId<T>()), ...);
+        return *this;
+    }
+
+    template <typename T>
+    bool SceneAccess::canRead() const
+    {
+        return canRead(ComponentRegistry::getTypeId<T>());
+    }
+
+    template <typename T>
+    bool SceneAccess::canWrite() const
+    {
+        return canWrite(ComponentRegistry::getTypeId<T>());
+    }
+}
@@ -0,0 +1,241 @@
+#pragma once
+#include "PantheonCore/ECS/Entity.h"
+
+#include <memory>
+#include <vector>
+
+namespace PantheonCore::ECS
+{
+    class Scene;
+
+    /**
+     * \brief Records structural scene changes (entity creation/destruction and component additions/modifications/removals)
+     * to apply them later, e.g. after iterating a scene view or from worker threads.\n
+     * A command buffer isn't thread-safe - use one buffer per thread and flush them from a single thread.\n
+     * When flushed, commands are applied in batches: entity creations first, then component commands grouped by storage
+     * (in recording order for a given storage) and finally entity destructions
+     */
+    class SceneCommandBuffer
+    {
+    public:
+        /**
+         * \brief The version of the placeholder entities returned by create() until the buffer is flushed
+         */
+        static constexpr Entity::Version PENDING_VERSION = Entity::VERSION_MASK;
+
+        /**
+         * \brief Creates an empty command buffer
+         */
+        SceneCommandBuffer() = default;
+
+        /**
+         * \brief Disable command buffer copy
+         */
+        SceneCommandBuffer(const SceneCommandBuffer&) = delete;
+
+        /**
+         * \brief Creates a move copy of the given command buffer
+         * \param other The command buffer to move
+         */
+        SceneCommandBuffer(SceneCommandBuffer&& other) noexcept = default;
+
+        /**
+         * \brief Destroys the command buffer and discards its pending commands
+         */
+        ~SceneCommandBuffer() = default;
+
+        /**
+         * \brief Disable command buffer copy
+         */
+        SceneCommandBuffer& operator=(const SceneCommandBuffer&) = delete;
+
+        /**
+         * \brief Moves the given command buffer into this one
+         * \param other The command buffer to move
+         * \return A reference to the modified command buffer
+         */
+        SceneCommandBuffer& operator=(SceneCommandBuffer&& other) noexcept = default;
+
+        /**
+         * \brief Records the creation of an entity
+         * \return A placeholder for the created entity, usable with this buffer's commands until it is flushed
+         */
+        Entity create();
+
+        /**
+         * \brief Records the destruction of the given entity
+         * \param entity The entity to destroy
+         */
+        void destroy(Entity entity);
+
+        /**
+         * \brief Records the creation or modification of the given entity's component of the given type.
+         * The component is constructed immediately and moved into the storage when the buffer is flushed
+         * \tparam T The component's type
+         * \tparam Args The component's construction parameters
+         * \param owner The component's owner
+         * \param args The component's construction parameters
+         */
+        template <typename T, typename... Args>
+        void make(Entity owner, Args&&... args);
+
+        /**
+         * \brief Records the assignment of the given component instance to the given entity
+         * \tparam T The component's type
+         * \param owner The component's owner
+         * \param instance The assigned component instance
+         */
+        template <typename T>
+        void set(Entity owner, const T& instance);
+
+        /**
+         * \brief Records the removal of the given entity's component of the given type
+         * \tparam T The component's type
+         * \param owner The component's owner
+         */
+        template <typename T>
+        void remove(Entity owner);
+
+        /**
+         * \brief Applies the recorded commands to the given scene and clears the buffer (keeping its allocated memory)
+         * \param scene The scene to modify
+         */
+        void flush(Scene& scene);
+
+        /**
+         * \brief Discards the recorded commands
+         */
+        void clear();
+
+        /**
+         * \brief Checks whether the buffer has any recorded command or not
+         * \return True if the buffer has no recorded command. False otherwise
+         */
+        bool empty() const;
+
+        /**
+         * \brief Checks whether the given entity is a placeholder returned by create()
+         * \param entity The entity to check
+         * \return True if the entity is a placeholder. False otherwise
+         */
+        static bool isPending(Entity entity);
+
+    private:
+        class ICommandQueue
+        {
+        public:
+            virtual ~ICommandQueue() = default;
+
+            /**
+             * \brief Applies the queued commands to the given scene
+             * \param scene The scene to modify
+             * \param created The created entities, indexed by placeholder index
+             */
+            virtual void flush(Scene& scene, const std::vector<Entity>& created) = 0;
+
+            /**
+             * \brief Discards the queued commands
+             */
+            virtual void clear() = 0;
+
+            /**
+             * \brief Checks whether the queue has any command or not
+             * \return True if the queue is empty. False otherwise
+             */
+            virtual bool empty() const = 0;
+        };
+
+        template <typename T>
+        class CommandQueue final : public ICommandQueue
+        {
+        public:
+            /**
+             * \brief Queues the creation or modification of the given entity's component
+             * \tparam Args The component's construction parameters
+             * \param owner The component's owner
+             * \param args The component's construction parameters
+             */
+            template <typename... Args>
+            void make(Entity owner, Args&&... args);
+
+            /**
+             * \brief Queues the assignment of the given component instance to the given entity
+             * \param owner The component's owner
+             * \param instance The assigned component instance
+             */
+            void set(Entity owner, const T& instance);
+
+            /**
+             * \brief Queues the removal of the given entity's component
+             * \param owner The component's owner
+             */
+            void remove(Entity owner);
+
+            /**
+             * \brief Applies the queued commands to the given scene
+             * \param scene The scene to modify
+             * \param created The created entities, indexed by placeholder index
+             */
+            void flush(Scene& scene, const std::vector<Entity>& created) override;
+
+            /**
+             * \brief Discards the queued commands
+             */
+            void clear() override;
+
+            /**
+             * \brief Checks whether the queue has any command or not
+             * \return True if the queue is empty. False otherwise
+             */
+            bool empty() const override;
+
+        private:
+            enum class ECommandType : uint8_t
+            {
+                MAKE,
+                SET,
+                REMOVE
+            };
+
+            struct Command
+            {
+                Entity       m_owner;
+                ECommandType m_type;
+                size_t       m_valueIndex;
+            };
+
+            std::vector<Command> m_commands;
+            std::vector<T>       m_values;
+
+            /**
+             * \brief Applies the queued commands to the given scene's archetypes
+             * \param scene The scene to modify
+             * \param created The created entities, indexed by placeholder index
+             */
+            void flushArchetypes(Scene& scene, const std::vector<Entity>& created);
+        };
+
+        std::vector<std::unique_ptr<ICommandQueue>> m_queues;
+        std::vector<Entity>                         m_destroyed;
+        std::vector<Entity>                         m_created;
+        Entity::Id                                  m_pendingCount = 0;
+
+        /**
+         * \brief Gets the command queue for the given component type, creating it if necessary
+         * \tparam T The queue's component type
+         * \return A reference to the command queue for the given component type
+         */
+        template <typename T>
+        CommandQueue<T>& getQueue();
+
+        /**
+         * \brief Converts the given entity to its scene entity if it is a placeholder
+         * \param entity The entity to resolve
+         * \param created The created entities, indexed by placeholder index
+         * \return The resolved entity
+         */
+        static Entity resolve(Entity entity, const std::vector<Entity>& created);
+    };
+}
+
+#include "PantheonCore/ECS/SceneCommandBuffer.inl"
@@ -0,0 +1,143 @@
+#pragma once
+#include "PantheonCore/ECS/SceneCommandBuffer.h"
+
+#include "PantheonCore/ECS/ComponentRegistry.h"
+#include "PantheonCore/ECS/Scene.h"
+
+namespace PantheonCore::ECS
+{
+    template <typename T, typename... Args>
+    void SceneCommandBuffer::make(const Entity owner, Args&&... args)
+    {
+        getQueue<T>().make(owner, std::forward<Args>(args)...);
+    }
+
+    template <typename T>
+    void SceneCommandBuffer::set(const Entity owner, const T& instance)
+    {
+        getQueue<T>().set(owner, instance);
+    }
+
+    template <typename T>
+    void SceneCommandBuffer::remove(const Entity owner)
+    {
+        getQueue<T>().remove(owner);
+    }
+
+    template <typename T>
+    SceneCommandBuffer::CommandQueue<T>& SceneCommandBuffer::getQueue()
+    {
+        static_assert(!std::is_const_v<T>);
+
+        const Utility::TypeId typeId = ComponentRegistry::getTypeId<T>();
+
+        if (typeId >= m_queues.size())
+            m_queues.resize(typeId + 1);
+
+        std::unique_ptr<ICommandQueue>& queue = m_queues[typeId];
+
+        if (!queue)
+            queue = std::make_unique<CommandQueue<T>>();
+
+        return static_cast<CommandQueue<T>&>(*queue);
+    }
+
+    template <typename T>
+    template <typename... Args>
+    void SceneCommandBuffer::CommandQueue<T>::make(const Entity owner, Args&&... args)
+    {
+        m_commands.push_back({ owner, ECommandType::MAKE, m_values.size() });
+        m_values.emplace_back(std::forward<Args>(args)...);
+    }
+
+    template <typename T>
+    void SceneCommandBuffer::CommandQueue<T>::set(const Entity owner, const T& instance)
+    {
+        m_commands.push_back({ owner, ECommandType::SET, m_values.size() });
+        m_values.push_back(instance);
+    }
+
+    template <typename T>
+    void SceneCommandBuffer::CommandQueue<T>::remove(const Entity owner)
+    {
+        m_commands.push_back({ owner, ECommandType::REMOVE, 0 });
+    }
+
+    template <typename T>
+    void SceneCommandBuffer::CommandQueue<T>::flush(Scene& scene, const std::vector<Entity>& created)
+    {
+        if (scene.isArchetypeComponent<T>())
+        {
+            flushArchetypes(scene, created);
+            return;
+        }
+
+        ComponentStorage<T>& storage = scene.getStorage<T>();
+        storage.reserve(static_cast<Entity::Id>(storage.getCount() + m_values.size()));
+
+        for (const Command& command : m_commands)
+        {
+            const Entity owner = resolve(command.m_owner, created);
+
+            if (!scene.isValid(owner))
+                continue;
+
+            switch (command.m_type)
+            {
+            case ECommandType::MAKE:
+                storage.construct(owner, std::move(m_values[command.m_valueIndex]));
+                break;
+            case ECommandType::SET:
+                storage.set(owner, m_values[command.m_valueIndex]);
+                break;
+            case ECommandType::REMOVE:
+                storage.remove(owner);
+                break;
+            }
+        }
+
+        clear();
+    }
+
+    template <typename T>
+    void SceneCommandBuffer::CommandQueue<T>::flushArchetypes(Scene& scene, const std::vector<Entity>& created)
+    {
+        ArchetypeStorage& archetypes = scene.getArchetypeStorage();
+
+        for (const Command& command : m_commands)
+        {
+            const Entity owner = resolve(command.m_owner, created);
+
+            if (!scene.isValid(owner))
+                continue;
+
+            switch (command.m_type)
+            {
+            case ECommandType::MAKE:
+                archetypes.construct<T>(owner, std::move(m_values[command.m_valueIndex]));
+                break;
+            case ECommandType::SET:
+                archetypes.set<T>(owner, m_values[command.m_valueIndex]);
+                break;
+            case ECommandType::REMOVE:
+                archetypes.remove<T>(owner);
+                break;
+            }
+        }
+
+        clear();
+    }
+
+    template <typename T>
+    void SceneCommandBuffer::CommandQueue<T>::clear()
+    {
+        m_commands.clear();
+        m_values.clear();
+    }
+
+    template <typename T>
+    bool SceneCommandBuffer::CommandQueue<T>::empty() const
+    {
+        return m_commands.empty();
+    }
+}
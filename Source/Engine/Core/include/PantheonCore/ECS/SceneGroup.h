@@ -0,0 +1,122 @@
+#pragma once
+#include "PantheonCore/ECS/ComponentStorage.h"
+#include "PantheonCore/ECS/ISceneGroup.h"
+#include "PantheonCore/Utility/TypeTraits.h"
+
+namespace PantheonCore::ECS
+{
+    /**
+     * \brief Owning group keeping the entities owning all of the given components packed at the front of each owned storage,
+     * in the same order. Iterating a group is a plain indexed loop over the owned storages' contiguous arrays
+     * \tparam Owned The group's owned component types
+     */
+    template <class... Owned>
+    class SceneGroup final : public ISceneGroup
+    {
+        static_assert(sizeof...(Owned) > 0);
+        static_assert(!Utility::HasDuplicates<Owned...>);
+        static_assert(!(std::is_const_v<Owned> || ...), "Owned component types can't be const");
+
+        template <typename T>
+        static constexpr bool Has = Utility::IsOneOf<T, Owned...>;
+
+    public:
+        using iterator = SparseSet::const_iterator;
+        using const_iterator = SparseSet::const_iterator;
+
+        /**
+         * \brief Creates a group owning the given storages and packs their common entities at the front
+         * \param storages The group's owned storages
+         */
+        explicit SceneGroup(ComponentStorage<Owned>&... storages);
+
+        /**
+         * \brief Destroys the group and releases its owned storages
+         */
+        ~SceneGroup() override;
+
+        /**
+         * \brief Moves the given entity into the group if it owns all of the group's components
+         * \param entity The updated entity
+         */
+        void onAdd(Entity entity) override;
+
+        /**
+         * \brief Moves the given entity out of the group if it is part of it
+         * \param entity The updated entity
+         */
+        void onRemove(Entity entity) override;
+
+        /**
+         * \brief Empties the group
+         */
+        void onClear() override;
+
+        /**
+         * \brief Checks if the given entity is part of the group
+         * \param entity The entity to check for
+         * \return True if the entity owns all of the group's components. False otherwise
+         */
+        bool contains(Entity entity) const;
+
+        /**
+         * \brief Gets the number of entities in the group
+         * \return The number of entities in the group
+         */
+        size_t size() const;
+
+        /**
+         * \brief Checks whether the group is empty or not
+         * \return True if the group is empty. False otherwise
+         */
+        bool empty() const;
+
+        /**
+         * \brief Gets the owned storage for the given component type
+         * \tparam T The target component type
+         * \return A reference to the owned storage for the given component type
+         */
+        template <typename T>
+        ComponentStorage<T>& getStorage() const;
+
+        /**
+         * \brief Gets a pointer to the group's components of the given type. The i-th component belongs to the i-th entity
+         * \tparam T The target component type
+         * \return A pointer to the first of the group's components of the given type
+         */
+        template <typename T>
+        T* data() const;
+
+        /**
+         * \brief Invokes the given function for each of the group's entities with either (Entity, Owned&...) or (Owned&...)
+         * \tparam Func The function's type
+         * \param func The function to invoke for each of the group's entities
+         */
+        template <typename Func>
+        void each(Func&& func) const;
+
+        /**
+         * \brief Gets an iterator to the group's first entity
+         * \return An iterator to the group's first entity
+         */
+        iterator begin() const;
+
+        /**
+         * \brief Gets an iterator to the end of the group's entities
+         * \return An iterator to the end of the group's entities
+         */
+        iterator end() const;
+
+    private:
+        std::tuple<ComponentStorage<Owned>*...> m_storages;
+        size_t                                  m_length;
+
+        /**
+         * \brief Gets the owners set of the first owned storage, which defines the group's entities order
+         * \return A reference to the first owned storage's owners set
+         */
+        const SparseSet& getOwners() const;
+    };
+}
+
+#include "PantheonCore/ECS/SceneGroup.inl"
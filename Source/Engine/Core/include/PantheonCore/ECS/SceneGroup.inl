@@ -0,0 +1,132 @@
+#pragma once
+#include "PantheonCore/ECS/SceneGroup.h"
+
+namespace PantheonCore::ECS
+{
+    template <class... Owned>
+    SceneGroup<Owned...>::SceneGroup(ComponentStorage<Owned>&... storages)
+        : m_storages(&storages...), m_length(0)
+    {
+        ASSERT(((storages.getGroup() == nullptr) && ...), "Unable to create group - A component storage is already owned by a group");
+
+        (storages.setGroup(this), ...);
+
+        const SparseSet* smallest = nullptr;
+        ((smallest = smallest == nullptr || storages.getCount() < smallest->size() ? &storages.getOwners() : smallest), ...);
+
+        // Entities are only ever swapped with the group's end, which is never after the current index
+        for (SparseSet::Index i = 0; i < smallest->size(); ++i)
+            onAdd((*smallest)[i]);
+    }
+
+    template <class... Owned>
+    SceneGroup<Owned...>::~SceneGroup()
+    {
+        std::apply([this](ComponentStorage<Owned>*... storages)
+        {
+            ((storages->getGroup() == this ? storages->setGroup(nullptr) : void()), ...);
+        }, m_storages);
+    }
+
+    template <class... Owned>
+    void SceneGroup<Owned...>::onAdd(const Entity entity)
+    {
+        std::apply([this, entity](ComponentStorage<Owned>*... storages)
+        {
+            if (!(storages->contains(entity) && ...) || contains(entity))
+                return;
+
+            (storages->swap(storages->getOwners().find(entity), m_length), ...);
+            ++m_length;
+        }, m_storages);
+    }
+
+    template <class... Owned>
+    void SceneGroup<Owned...>::onRemove(const Entity entity)
+    {
+        if (!contains(entity))
+            return;
+
+        --m_length;
+
+        std::apply([this, entity](ComponentStorage<Owned>*... storages)
+        {
+            (storages->swap(storages->getOwners().find(entity), m_length), ...);
+        }, m_storages);
+    }
+
+    template <class... Owned>
+    void SceneGroup<Owned...>::onClear()
+    {
+        m_length = 0;
+    }
+
+    template <class... Owned>
+    bool SceneGroup<Owned...>::contains(const Entity entity) const
+    {
+        return getOwners().find(entity) < m_length;
+    }
+
+    template <class... Owned>
+    size_t SceneGroup<Owned...>::size() const
+    {
+        return m_length;
+    }
+
+    template <class... Owned>
+    bool SceneGroup<Owned...>::empty() const
+    {
+        return m_length == 0;
+    }
+
+    template <class... Owned>
+    template <typename T>
+    ComponentStorage<T>& SceneGroup<Owned...>::getStorage() const
+    {
+        static_assert(Has<T>);
+        return *std::get<ComponentStorage<T>*>(m_storages);
+    }
+
+    template <class... Owned>
+    template <typename T>
+    T* SceneGroup<Owned...>::data() const
+    {
+        return getStorage<T>().data();
+    }
+
+    template <class... Owned>
+    template <typename Func>
+    void SceneGroup<Owned...>::each(Func&& func) const
+    {
+        const Entity* entities = getOwners().data();
+
+        std::apply([this, entities, &func](Owned*... components)
+        {
+            for (size_t i = 0; i < m_length; ++i)
+            {
+                if constexpr (std::is_invocable_v<Func&, Entity, Owned&...>)
+                    func(entities[i], components[i]...);
+                else
+                    func(components[i]...);
+            }
+        }, std::make_tuple(data<Owned>()...));
+    }
+
+    template <class... Owned>
+    typename SceneGroup<Owned...>::iterator SceneGroup<Owned...>::begin() const
+    {
+        return getOwners().begin();
+    }
+
+    template <class... Owned>
+    typename SceneGroup<Owned...>::iterator SceneGroup<Owned...>::end() const
+    {
+        return getOwners().begin() + static_cast<std::ptrdiff_t>(m_length);
+    }
+
+    template <class... Owned>
+    const SparseSet& SceneGroup<Owned...>::getOwners() const
+    {
+        return std::get<0>(m_storages)->getOwners();
+    }
+}
@@ -0,0 +1,135 @@
+#pragma once
+#include "PantheonCore/ECS/ComponentStorage.h"
+#include "PantheonCore/ECS/ISceneObserver.h"
+#include "PantheonCore/Utility/TypeTraits.h"
+
+namespace PantheonCore::ECS
+{
+    /**
+     * \brief Lists the component types an entity must not own to match a scene observer
+     * \tparam T The excluded component types
+     */
+    template <typename... T>
+    struct Exclude
+    {
+    };
+
+    template <class Filter, class... Included>
+    class SceneObserver;
+
+    /**
+     * \brief Persistent query keeping a packed list of the entities owning all of the included components and none of the
+     * excluded ones. The list is updated incrementally from the storages' add and remove events, so iterating the matches
+     * is a plain loop over a contiguous array, regardless of the storages' sizes.\n
+     * Components are fetched through their storage's sparse index. The matches' order is unspecified
+     * \tparam Excluded The component types the matched entities must not own
+     * \tparam Included The component types the matched entities must own
+     */
+    template <class... Excluded, class... Included>
+    class SceneObserver<Exclude<Excluded...>, Included...> final : public ISceneObserver
+    {
+        static_assert(sizeof...(Included) > 0);
+        static_assert(!Utility::HasDuplicates<Included..., Excluded...>);
+        static_assert(!(std::is_const_v<Included> || ...) && !(std::is_const_v<Excluded> || ...),
+            "Observed component types can't be const");
+
+    public:
+        using iterator = SparseSet::const_iterator;
+        using const_iterator = SparseSet::const_iterator;
+
+        /**
+         * \brief Creates an observer listening to the given storages and fills it with their current matches
+         * \param included The storages of the component types the matched entities must own
+         * \param excluded The storages of the component types the matched entities must not own
+         */
+        SceneObserver(std::tuple<ComponentStorage<Included>&...> included, std::tuple<ComponentStorage<Excluded>&...> excluded);
+
+        /**
+         * \brief Destroys the observer and stops listening to its storages
+         */
+        ~SceneObserver() override;
+
+        /**
+         * \brief Rebuilds the observer's matches from its storages
+         */
+        void refresh() override;
+
+        /**
+         * \brief Checks if the given entity matches the observer
+         * \param entity The entity to check for
+         * \return True if the entity is in the observer's matches. False otherwise
+         */
+        bool contains(Entity entity) const;
+
+        /**
+         * \brief Gets the number of entities matching the observer
+         * \return The number of matched entities
+         */
+        size_t size() const;
+
+        /**
+         * \brief Checks whether the observer has any match or not
+         * \return True if no entity matches the observer. False otherwise
+         */
+        bool empty() const;
+
+        /**
+         * \brief Gets a pointer to the observer's packed matches
+         * \return A pointer to the first matched entity
+         */
+        const Entity* data() const;
+
+        /**
+         * \brief Invokes the given function for each of the observer's matches with either (Entity, Included&...) or (Included&...)
+         * \tparam Func The function's type
+         * \param func The function to invoke for each matched entity
+         */
+        template <typename Func>
+        void each(Func&& func) const;
+
+        /**
+         * \brief Gets an iterator to the observer's first match
+         * \return An iterator to the observer's first match
+         */
+        iterator begin() const;
+
+        /**
+         * \brief Gets an iterator to the end of the observer's matches
+         * \return An iterator to the end of the observer's matches
+         */
+        iterator end() const;
+
+    private:
+        using Listener = std::pair<Eventing::IEvent*, Eventing::IEvent::ListenerId>;
+
+        std::tuple<ComponentStorage<Included>*...> m_included;
+        std::tuple<ComponentStorage<Excluded>*...> m_excluded;
+        std::vector<Listener>                      m_listeners;
+        SparseSet                                  m_matches;
+
+        /**
+         * \brief Checks if the given entity owns all the included components and none of the excluded ones
+         * \tparam Ignored An excluded component type to ignore (e.g. because it is being removed), or void
+         * \param entity The entity to check
+         * \return True if the entity matches the observer. False otherwise
+         */
+        template <typename Ignored = void>
+        bool isMatch(Entity entity) const;
+
+        /**
+         * \brief Adds the given entity to the matches if it isn't part of them yet and matches the observer
+         * \tparam Ignored An excluded component type to ignore (e.g. because it is being removed), or void
+         * \param entity The updated entity
+         */
+        template <typename Ignored = void>
+        void tryInsert(Entity entity);
+
+        /**
+         * \brief Removes the given entity from the matches if it is part of them
+         * \param entity The updated entity
+         */
+        void tryErase(Entity entity);
+    };
+}
+
+#include "PantheonCore/ECS/SceneObserver.inl"
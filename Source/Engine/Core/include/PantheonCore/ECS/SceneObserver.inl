@@ -0,0 +1,164 @@
+#pragma once
+#include "PantheonCore/ECS/SceneObserver.h"
+
+namespace PantheonCore::ECS
+{
+    template <class... Excluded, class... Included>
+    SceneObserver<Exclude<Excluded...>, Included...>::SceneObserver(std::tuple<ComponentStorage<Included>&...> included,
+        std::tuple<ComponentStorage<Excluded>&...> excluded)
+    {
+        std::apply([this](ComponentStorage<Included>&... storages)
+        {
+            m_included = { &storages... };
+        }, included);
+
+        std::apply([this](ComponentStorage<Excluded>&... storages)
+        {
+            m_excluded = { &storages... };
+        }, excluded);
+
+        // Add events are invoked once the component exists, remove events right before it is erased
+        const auto onIncludedAdd = [this](const EntityHandle& handle, auto&)
+        {
+            tryInsert(handle.getEntity());
+        };
+
+        const auto onIncludedRemove = [this](const EntityHandle& handle, auto&)
+        {
+            tryErase(handle.getEntity());
+        };
+
+        const auto onExcludedAdd = [this](const EntityHandle& handle, auto&)
+        {
+            tryErase(handle.getEntity());
+        };
+
+        const auto onExcludedRemove = [this]<typename T>(const EntityHandle& handle, T&)
+        {
+            tryInsert<T>(handle.getEntity());
+        };
+
+        m_listeners.reserve(2 * (sizeof...(Included) + sizeof...(Excluded)));
+
+        std::apply([&](ComponentStorage<Included>*... storages)
+        {
+            ((m_listeners.emplace_back(&storages->m_onAdd, storages->m_onAdd.subscribe(onIncludedAdd)),
+                m_listeners.emplace_back(&storages->m_onRemove, storages->m_onRemove.subscribe(onIncludedRemove))), ...);
+        }, m_included);
+
+        std::apply([&](ComponentStorage<Excluded>*... storages)
+        {
+            ((m_listeners.emplace_back(&storages->m_onAdd, storages->m_onAdd.subscribe(onExcludedAdd)),
+                m_listeners.emplace_back(&storages->m_onRemove, storages->m_onRemove.subscribe(onExcludedRemove))), ...);
+        }, m_excluded);
+
+        refresh();
+    }
+
+    template <class... Excluded, class... Included>
+    SceneObserver<Exclude<Excluded...>, Included...>::~SceneObserver()
+    {
+        for (const auto& [event, listener] : m_listeners)
+            event->unsubscribe(listener);
+    }
+
+    template <class... Excluded, class... Included>
+    void SceneObserver<Exclude<Excluded...>, Included...>::refresh()
+    {
+        m_matches.clear();
+
+        std::apply([this](ComponentStorage<Included>*... storages)
+        {
+            const SparseSet* smallest = nullptr;
+            ((smallest = smallest == nullptr || storages->getCount() < smallest->size() ? &storages->getOwners() : smallest), ...);
+
+            for (const Entity entity : *smallest)
+            {
+                if (isMatch(entity))
+                    m_matches.insert(entity);
+            }
+        }, m_included);
+    }
+
+    template <class... Excluded, class... Included>
+    bool SceneObserver<Exclude<Excluded...>, Included...>::contains(const Entity entity) const
+    {
+        return m_matches.contains(entity);
+    }
+
+    template <class... Excluded, class... Included>
+    size_t SceneObserver<Exclude<Excluded...>, Included...>::size() const
+    {
+        return m_matches.size();
+    }
+
+    template <class... Excluded, class... Included>
+    bool SceneObserver<Exclude<Excluded...>, Included...>::empty() const
+    {
+        return m_matches.empty();
+    }
+
+    template <class... Excluded, class... Included>
+    const Entity* SceneObserver<Exclude<Excluded...>, Included...>::data() const
+    {
+        return m_matches.data();
+    }
+
+    template <class... Excluded, class... Included>
+    template <typename Func>
+    void SceneObserver<Exclude<Excluded...>, Included...>::each(Func&& func) const
+    {
+        std::apply([this, &func](ComponentStorage<Included>*... storages)
+        {
+            for (const Entity entity : m_matches)
+            {
+                if constexpr (std::is_invocable_v<Func&, Entity, Included&...>)
+                    func(entity, *storages->find(entity)...);
+                else
+                    func(*storages->find(entity)...);
+            }
+        }, m_included);
+    }
+
+    template <class... Excluded, class... Included>
+    typename SceneObserver<Exclude<Excluded...>, Included...>::iterator SceneObserver<Exclude<Excluded...>, Included...>::begin() const
+    {
+        return m_matches.begin();
+    }
+
+    template <class... Excluded, class... Included>
+    typename SceneObserver<Exclude<Excluded...>, Included...>::iterator SceneObserver<Exclude<Excluded...>, Included...>::end() const
+    {
+        return m_matches.end();
+    }
+
+    template <class... Excluded, class... Included>
+    template <typename Ignored>
+    bool SceneObserver<Exclude<Excluded...>, Included...>::isMatch(const Entity entity) const
+    {
+        const bool hasIncluded = std::apply([entity](const ComponentStorage<Included>*... storages)
+        {
+            return (storages->contains(entity) && ...);
+        }, m_included);
+
+        return hasIncluded && std::apply([entity](const ComponentStorage<Excluded>*... storages)
+        {
+            return ((std::is_same_v<Excluded, Ignored> || !storages->contains(entity)) && ...);
+        }, m_excluded);
+    }
+
+    template <class... Excluded, class... Included>
+    template <typename Ignored>
+    void SceneObserver<Exclude<Excluded...>, Included...>::tryInsert(const Entity entity)
+    {
+        if (!m_matches.contains(entity) && isMatch<Ignored>(entity))
+            m_matches.insert(entity);
+    }
+
+    template <class... Excluded, class... Included>
+    void SceneObserver<Exclude<Excluded...>, Included...>::tryErase(const Entity entity)
+    {
+        if (const SparseSet::Index index = m_matches.find(entity); index != SparseSet::INVALID_INDEX)
+            m_matches.erase(index);
+    }
+}
@@ -0,0 +1,180 @@
+#pragma once
+#include "PantheonCore/ECS/Entity.h"
+#include "PantheonCore/Utility/TypeId.h"
+
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace PantheonCore::ECS
+{
+    class IComponentStorage;
+    class Scene;
+
+    /**
+     * \brief A copy of a scene's entities and components, used to quickly roll a scene back to a previous state
+     * (e.g. for replays or network rollbacks). See Scene::saveSnapshot and Scene::restoreSnapshot.\n
+     * The snapshot is a sequence of arrays stored in an arena that is reused across captures. Arrays of trivially copyable
+     * types are copied in and out with memcpy, other types are copy constructed in the arena.
+     * When a capture doesn't fit in the arena, additional pages are allocated and merged into a single one on the next capture
+     */
+    class SceneSnapshot
+    {
+    public:
+        using TypeId = Utility::TypeId;
+        using StorageFactory = std::unique_ptr<IComponentStorage> (*)(Scene*);
+
+        /**
+         * \brief Reads the arrays of a snapshot in the order in which they were written
+         */
+        class Reader
+        {
+        public:
+            /**
+             * \brief Creates a reader starting at the given snapshot's first array
+             * \param snapshot The snapshot to read
+             */
+            explicit Reader(const SceneSnapshot& snapshot);
+
+            /**
+             * \brief Reads the next array of the snapshot
+             * \tparam T The array's element type. Must match the written type
+             * \return A view of the array's elements, valid until the snapshot is modified
+             */
+            template <typename T>
+            std::span<const T> read();
+
+            /**
+             * \brief Reads the next single value of the snapshot
+             * \tparam T The value's type. Must match the written type
+             * \return A reference to the value, valid until the snapshot is modified
+             */
+            template <typename T>
+            const T& readValue();
+
+        private:
+            const SceneSnapshot* m_snapshot;
+            size_t               m_block;
+        };
+
+        /**
+         * \brief Creates an empty snapshot without preallocated memory
+         */
+        SceneSnapshot() = default;
+
+        /**
+         * \brief Creates an empty snapshot with the given arena capacity
+         * \param capacity The number of bytes to preallocate
+         */
+        explicit SceneSnapshot(size_t capacity);
+
+        /**
+         * \brief Disable scene snapshot copy
+         */
+        SceneSnapshot(const SceneSnapshot&) = delete;
+
+        /**
+         * \brief Creates a move copy of the given scene snapshot. The moved snapshot is left empty, without an arena
+         * \param other The scene snapshot to move
+         */
+        SceneSnapshot(SceneSnapshot&& other) noexcept;
+
+        /**
+         * \brief Destroys the scene snapshot and the copies it holds
+         */
+        ~SceneSnapshot();
+
+        /**
+         * \brief Disable scene snapshot copy
+         */
+        SceneSnapshot& operator=(const SceneSnapshot&) = delete;
+
+        /**
+         * \brief Moves the given scene snapshot into this one
+         * \param other The scene snapshot to move
+         * \return A reference to the modified scene snapshot
+         */
+        SceneSnapshot& operator=(SceneSnapshot&& other) noexcept;
+
+        /**
+         * \brief Appends a copy of the given array to the snapshot
+         * \tparam T The array's element type
+         * \param data A pointer to the array's first element
+         * \param count The array's number of elements
+         */
+        template <typename T>
+        void write(const T* data, size_t count);
+
+        /**
+         * \brief Appends a copy of the given value to the snapshot
+         * \tparam T The value's type
+         * \param value The value to copy
+         */
+        template <typename T>
+        void write(const T& value);
+
+        /**
+         * \brief Destroys the snapshot's content. The arena's memory is kept for the next capture
+         */
+        void clear();
+
+        /**
+         * \brief Grows the arena to at least the given number of bytes
+         * \param capacity The arena's minimum capacity
+         */
+        void reserve(size_t capacity);
+
+        /**
+         * \brief Checks whether the snapshot holds any data or not
+         * \return True if the snapshot is empty. False otherwise
+         */
+        bool empty() const;
+
+        /**
+         * \brief Gets the number of arena bytes used by the snapshot's content
+         * \return The snapshot's size in bytes
+         */
+        size_t getSize() const;
+
+        /**
+         * \brief Gets the number of bytes allocated for the arena
+         * \return The arena's capacity in bytes
+         */
+        size_t getCapacity() const;
+
+    private:
+        struct Page
+        {
+            std::unique_ptr<std::byte[]> m_data;
+            size_t                       m_size;
+        };
+
+        struct Block
+        {
+            std::byte* m_data;
+            size_t     m_count;
+            size_t     m_elementSize;
+
+            void (*m_destroy)(std::byte* data, size_t count);
+        };
+
+        static constexpr size_t MIN_PAGE_SIZE = 16 * 1024;
+
+        std::vector<Page>  m_pages;
+        std::vector<Block> m_blocks;
+        size_t             m_page     = 0;
+        size_t             m_offset   = 0;
+        size_t             m_size     = 0;
+        size_t             m_capacity = 0;
+
+        /**
+         * \brief Allocates the given number of bytes in the arena, adding a page if the current ones are full
+         * \param size The number of bytes to allocate
+         * \param alignment The allocation's alignment
+         * \return A pointer to the allocated memory
+         */
+        std::byte* allocate(size_t size, size_t alignment);
+    };
+}
+
+#include "PantheonCore/ECS/SceneSnapshot.inl"
@@ -0,0 +1,62 @@
+#pragma once
+#include "PantheonCore/ECS/SceneSnapshot.h"
+
+#include "PantheonCore/Debug/Assertion.h"
+
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+namespace PantheonCore::ECS
+{
+    template <typename T>
+    std::span<const T> SceneSnapshot::Reader::read()
+    {
+        ASSERT(m_block < m_snapshot->m_blocks.size(), "Unable to read scene snapshot - No data left");
+
+        const Block& block = m_snapshot->m_blocks[m_block++];
+        ASSERT(block.m_elementSize == sizeof(T), "Unable to read scene snapshot - Type mismatch");
+
+        return { reinterpret_cast<const T*>(block.m_data), block.m_count };
+    }
+
+    template <typename T>
+    const T& SceneSnapshot::Reader::readValue()
+    {
+        const std::span<const T> values = read<T>();
+        ASSERT(values.size() == 1, "Unable to read scene snapshot value - Found an array of %llu elements", values.size());
+
+        return values.front();
+    }
+
+    template <typename T>
+    void SceneSnapshot::write(const T* data, const size_t count)
+    {
+        static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "Over-aligned types can't be stored in scene snapshots");
+
+        std::byte* block = count > 0 ? allocate(sizeof(T) * count, alignof(T)) : nullptr;
+
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            if (count > 0)
+                std::memcpy(block, data, sizeof(T) * count);
+
+            m_blocks.push_back({ block, count, sizeof(T), nullptr });
+        }
+        else
+        {
+            std::uninitialized_copy_n(data, count, reinterpret_cast<T*>(block));
+
+            m_blocks.push_back({ block, count, sizeof(T), [](std::byte* copies, const size_t copyCount)
+            {
+                std::destroy_n(reinterpret_cast<T*>(copies), copyCount);
+            } });
+        }
+    }
+
+    template <typename T>
+    void SceneSnapshot::write(const T& value)
+    {
+        write(&value, 1);
+    }
+}
@@ -1,5 +1,7 @@
 #pragma once
+#include "PantheonCore/ECS/SceneViewEach.h"
 #include "PantheonCore/ECS/SceneViewIterator.h"
+#include "PantheonCore/Utility/ThreadPool.h"
 #include "PantheonCore/Utility/TypeTraits.h"
 
 namespace PantheonCore::ECS
@@ -23,9 +25,10 @@ namespace PantheonCore::ECS
     public:
         using iterator = SceneViewIterator<IsAllConst, Components...>;
         using const_iterator = SceneViewIterator<true, Components...>;
+        using EachRange = SceneViewEach<IsAllConst, Components...>;
+        using ConstEachRange = SceneViewEach<true, Components...>;
         using SceneRef = std::conditional_t<IsAllConst, const Scene&, Scene&>;
         using ScenePtr = std::conditional_t<IsAllConst, const Scene*, Scene*>;
-        using EntityStorageRef = std::conditional_t<IsAllConst, const EntityStorage&, EntityStorage&>;
 
         /**
          * \brief Creates a view for the given scene
@@ -111,7 +114,9 @@ namespace PantheonCore::ECS
         void setStorage(ComponentStorage<T>& storage);
 
         /**
-         * \brief Gets an iterator to the start of the scene view
+         * \brief Gets an iterator to the start of the scene view.
+         * Iteration walks the owners of the smallest linked storage and only probes the other storages.
+         * When some of the components are stored in archetypes, iteration walks the chunks of the matching archetypes instead
          * \return An iterator to the start of the scene view
          */
         iterator begin();
@@ -134,9 +139,89 @@ namespace PantheonCore::ECS
          */
         const_iterator end() const;
 
+        /**
+         * \brief Gets an iterable range yielding a tuple of each matching entity followed by references to its components.
+         * Each component is fetched from the dense index resolved while checking the entity's validity
+         * \return An iterable range over the view's entities and components
+         */
+        EachRange each();
+
+        /**
+         * \brief Gets an iterable range yielding a tuple of each matching entity followed by constant references to its components
+         * \return An iterable range over the view's entities and components
+         */
+        ConstEachRange each() const;
+
+        /**
+         * \brief Gets an iterable range yielding a tuple of each matching entity followed by references to its components,
+         * skipping the entities for which none of the components with change tracking enabled changed since the given tick.\n
+         * Storages without change tracking and archetype components never report changes
+         * \param tick The oldest tick considered as a change (e.g. the tick returned by Scene::advanceTick after the last query)
+         * \return An iterable range over the view's changed entities and their components
+         */
+        EachRange changedSince(Tick tick);
+
+        /**
+         * \brief Gets an iterable range yielding a tuple of each matching entity followed by constant references to its components,
+         * skipping the entities for which none of the components with change tracking enabled changed since the given tick
+         * \param tick The oldest tick considered as a change
+         * \return An iterable range over the view's changed entities and their components
+         */
+        ConstEachRange changedSince(Tick tick) const;
+
+        /**
+         * \brief Invokes the given function for each matching entity with either (Entity, Components&...) or (Components&...)
+         * \tparam Func The function's type
+         * \param func The function to invoke for each matching entity
+         */
+        template <typename Func>
+        void each(Func&& func);
+
+        /**
+         * \brief Invokes the given function for each matching entity with either (Entity, const Components&...)
+         * or (const Components&...)
+         * \tparam Func The function's type
+         * \param func The function to invoke for each matching entity
+         */
+        template <typename Func>
+        void each(Func&& func) const;
+
+        /**
+         * \brief Splits the matching entities into chunks of the given size and invokes the given function for each of them
+         * on the given thread pool's workers, with either (Entity, Components&...) or (Components&...).\n
+         * The calling thread processes the first chunk itself, then executes the pool's queued tasks until every chunk is done.
+         * Can be called from one of the given pool's tasks (e.g. a system).\n
+         * Thread-safety: the function may freely write to the components it receives, which belong to a single entity.
+         * It may read other entities' components as long as no invocation writes to them.
+         * It must NOT create or destroy entities, add or remove components (including through the view or the scene),
+         * or call ComponentStorage::set, as these modify shared storages and invoke non thread-safe events.
+         * \tparam Func The function's type
+         * \param threadPool The thread pool on which to dispatch the chunks
+         * \param func The function to invoke for each matching entity
+         * \param grainSize The number of driving storage entries processed by each task.
+         * Rounded up to whole chunks when iterating archetypes
+         */
+        template <typename Func>
+        void parallelEach(Utility::ThreadPool& threadPool, Func&& func, size_t grainSize = 1024);
+
+        /**
+         * \brief Splits the matching entities into chunks of the given size and invokes the given function for each of them
+         * on the given thread pool's workers, with either (Entity, const Components&...) or (const Components&...).\n
+         * The calling thread processes the first chunk itself, then executes the pool's queued tasks until every chunk is done.\n
+         * Thread-safety: see the non-constant overload
+         * \tparam Func The function's type
+         * \param threadPool The thread pool on which to dispatch the chunks
+         * \param func The function to invoke for each matching entity
+         * \param grainSize The number of driving storage entries processed by each task
+         */
+        template <typename Func>
+        void parallelEach(Utility::ThreadPool& threadPool, Func&& func, size_t grainSize = 1024) const;
+
     private:
         ScenePtr                                     m_scene;
         std::tuple<ComponentStorage<Components>*...> m_storages;
+        ArchetypeStorage*                            m_archetypeStorage = nullptr;
+        const std::vector<ArchetypeStorage::Index>*  m_archetypes       = nullptr;
 
         /**
          * \brief Sets up the view's component storages for the current scene
@@ -145,6 +230,60 @@ namespace PantheonCore::ECS
          */
         template <typename T, typename... Remainder>
         void initializeView();
+
+        /**
+         * \brief Finds the scene's archetypes owning the view's archetype components, if any
+         */
+        void initializeArchetypes();
+
+        /**
+         * \brief Creates an iterator to the start or the end of the scene view
+         * \tparam Iterator The scene view iterator's type
+         * \param isEnd Whether the iterator should point to the end of the view
+         * \param since The oldest tick considered as a change. 0 to ignore changes
+         * \return The created iterator
+         */
+        template <typename Iterator>
+        Iterator makeIterator(bool isEnd, Tick since = 0) const;
+
+        /**
+         * \brief Gets the owners set of the linked storage with the fewest components
+         * \return A reference to the smallest linked storage's owners set
+         */
+        const SparseSet& getDriver() const;
+
+        /**
+         * \brief Invokes the given function with the iterated entity and components of the given iterator
+         * \tparam Func The function's type
+         * \tparam Iterator The scene view iterator's type
+         * \param func The function to invoke
+         * \param it The scene view iterator from which the function's arguments should be fetched
+         */
+        template <typename Func, typename Iterator>
+        static void invoke(Func& func, const Iterator& it);
+
+        /**
+         * \brief Dispatches the chunks of a parallel iteration on the given thread pool
+         * \tparam Iterator The scene view iterator's type
+         * \tparam Func The function's type
+         * \param threadPool The thread pool on which to dispatch the chunks
+         * \param func The function to invoke for each matching entity
+         * \param grainSize The number of driving storage entries processed by each task
+         */
+        template <typename Iterator, typename Func>
+        void dispatchChunks(Utility::ThreadPool& threadPool, Func& func, size_t grainSize) const;
+
+        /**
+         * \brief Dispatches the archetype chunks of a parallel iteration on the given thread pool.
+         * Each task processes whole chunks, until it reaches the given number of rows
+         * \tparam Iterator The scene view iterator's type
+         * \tparam Func The function's type
+         * \param threadPool The thread pool on which to dispatch the chunks
+         * \param func The function to invoke for each matching entity
+         * \param grainSize The minimum number of archetype rows processed by each task
+         */
+        template <typename Iterator, typename Func>
+        void dispatchArchetypeChunks(Utility::ThreadPool& threadPool, Func& func, size_t grainSize) const;
     };
 }
 
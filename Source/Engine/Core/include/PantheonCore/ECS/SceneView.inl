@@ -10,12 +10,14 @@ namespace PantheonCore::ECS
         : m_scene(&scene)
     {
         initializeView<Components...>();
+        initializeArchetypes();
     }
 
     template <class... Components>
     void SceneView<Components...>::refresh()
     {
         initializeView<Components...>();
+        initializeArchetypes();
     }
 
     template <class... Components>
@@ -30,6 +32,10 @@ namespace PantheonCore::ECS
     T* SceneView<Components...>::get(const Entity owner)
     {
         static_assert(Has<T>);
+
+        if (m_scene->template isArchetypeComponent<T>())
+            return m_scene->template get<T>(owner);
+
         return getStorage<T>().find(owner);
     }
 
@@ -44,6 +50,8 @@ namespace PantheonCore::ECS
     ComponentStorage<T>& SceneView<Components...>::getStorage()
     {
         static_assert(Has<T>);
+        ASSERT(!m_scene->template isArchetypeComponent<T>(), "Unable to get view storage - The component type is stored in archetypes");
+
         if constexpr (Utility::IsOneOf<T, Components...>)
             return *std::get<IndexOf<T>>(m_storages);
         else
@@ -64,38 +72,256 @@ namespace PantheonCore::ECS
     template <class... Components>
     typename SceneView<Components...>::iterator SceneView<Components...>::begin()
     {
-        EntityStorageRef entities = m_scene->template getStorage<Entity>();
-        return iterator(entities.begin(), entities.end(), m_storages);
+        return makeIterator<iterator>(false);
     }
 
     template <class... Components>
     typename SceneView<Components...>::iterator SceneView<Components...>::end()
     {
-        EntityStorageRef entities = m_scene->template getStorage<Entity>();
-        return iterator(entities.end(), entities.end(), m_storages);
+        return makeIterator<iterator>(true);
     }
 
     template <class... Components>
     typename SceneView<Components...>::const_iterator SceneView<Components...>::begin() const
     {
-        const EntityStorage& entities = m_scene->template getStorage<Entity>();
-        return const_iterator(entities.begin(), entities.end(), m_storages);
+        return makeIterator<const_iterator>(false);
     }
 
     template <class... Components>
     typename SceneView<Components...>::const_iterator SceneView<Components...>::end() const
     {
-        const EntityStorage& entities = m_scene->template getStorage<Entity>();
-        return const_iterator(entities.end(), entities.end(), m_storages);
+        return makeIterator<const_iterator>(true);
+    }
+
+    template <class... Components>
+    typename SceneView<Components...>::EachRange SceneView<Components...>::each()
+    {
+        return EachRange(begin(), end());
+    }
+
+    template <class... Components>
+    typename SceneView<Components...>::ConstEachRange SceneView<Components...>::each() const
+    {
+        return ConstEachRange(begin(), end());
+    }
+
+    template <class... Components>
+    typename SceneView<Components...>::EachRange SceneView<Components...>::changedSince(const Tick tick)
+    {
+        return EachRange(makeIterator<iterator>(false, tick), makeIterator<iterator>(true, tick));
+    }
+
+    template <class... Components>
+    typename SceneView<Components...>::ConstEachRange SceneView<Components...>::changedSince(const Tick tick) const
+    {
+        return ConstEachRange(makeIterator<const_iterator>(false, tick), makeIterator<const_iterator>(true, tick));
+    }
+
+    template <class... Components>
+    template <typename Func>
+    void SceneView<Components...>::each(Func&& func)
+    {
+        for (auto it = begin(), last = end(); it != last; ++it)
+            invoke(func, it);
+    }
+
+    template <class... Components>
+    template <typename Func>
+    void SceneView<Components...>::each(Func&& func) const
+    {
+        for (auto it = begin(), last = end(); it != last; ++it)
+            invoke(func, it);
+    }
+
+    template <class... Components>
+    template <typename Func>
+    void SceneView<Components...>::parallelEach(Utility::ThreadPool& threadPool, Func&& func, const size_t grainSize)
+    {
+        dispatchChunks<iterator>(threadPool, func, grainSize);
+    }
+
+    template <class... Components>
+    template <typename Func>
+    void SceneView<Components...>::parallelEach(Utility::ThreadPool& threadPool, Func&& func, const size_t grainSize) const
+    {
+        dispatchChunks<const_iterator>(threadPool, func, grainSize);
     }
 
     template <class... Components>
     template <typename T, typename... Remainder>
     void SceneView<Components...>::initializeView()
     {
-        setStorage<T>(const_cast<ComponentStorage<T>&>(m_scene->template getStorage<T>()));
+        // Archetype components don't have a storage - the view iterates over the matching archetypes instead
+        if (m_scene->template isArchetypeComponent<T>())
+            std::get<IndexOf<T>>(m_storages) = nullptr;
+        else
+            setStorage<T>(const_cast<ComponentStorage<T>&>(m_scene->template getStorage<T>()));
 
         if constexpr (sizeof...(Remainder) > 0)
             initializeView<Remainder...>();
     }
+
+    template <class... Components>
+    void SceneView<Components...>::initializeArchetypes()
+    {
+        std::vector<Utility::TypeId> types;
+
+        ((m_scene->template isArchetypeComponent<Components>() ? types.push_back(ComponentRegistry::getTypeId<Components>()) : void()),
+            ...);
+
+        if (types.empty())
+        {
+            m_archetypeStorage = nullptr;
+            m_archetypes       = nullptr;
+            return;
+        }
+
+        m_archetypeStorage = &const_cast<ArchetypeStorage&>(m_scene->getArchetypeStorage());
+        m_archetypes       = &m_archetypeStorage->query(std::move(types));
+    }
+
+    template <class... Components>
+    template <typename Iterator>
+    Iterator SceneView<Components...>::makeIterator(const bool isEnd, const Tick since) const
+    {
+        if (m_archetypes)
+        {
+            const ArchetypeStorage::ChunkPosition last = { m_archetypes->size(), 0 };
+            return Iterator(*m_archetypeStorage, *m_archetypes, isEnd ? last : ArchetypeStorage::ChunkPosition{ 0, 0 }, last,
+                m_storages, since);
+        }
+
+        const SparseSet& driver = getDriver();
+        return Iterator(isEnd ? driver.end() : driver.begin(), driver.end(), m_storages, &driver, since);
+    }
+
+    template <class... Components>
+    const SparseSet& SceneView<Components...>::getDriver() const
+    {
+        const SparseSet* driver = nullptr;
+
+        std::apply([&driver](const auto*... storages)
+        {
+            ((driver = driver == nullptr || storages->getCount() < driver->size() ? &storages->getOwners() : driver), ...);
+        }, m_storages);
+
+        return *driver;
+    }
+
+    template <class... Components>
+    template <typename Func, typename Iterator>
+    void SceneView<Components...>::invoke(Func& func, const Iterator& it)
+    {
+        if constexpr (std::is_invocable_v<Func&, Entity, typename Iterator::template ComponentRef<Components>...>)
+            std::apply(func, std::tuple_cat(std::make_tuple(*it), it.getComponents()));
+        else
+            std::apply(func, it.getComponents());
+    }
+
+    template <class... Components>
+    template <typename Iterator, typename Func>
+    void SceneView<Components...>::dispatchChunks(Utility::ThreadPool& threadPool, Func& func, size_t grainSize) const
+    {
+        if (m_archetypes)
+        {
+            dispatchArchetypeChunks<Iterator>(threadPool, func, grainSize);
+            return;
+        }
+
+        const SparseSet& driver = getDriver();
+        const size_t     count  = driver.size();
+
+        grainSize = grainSize > 0 ? grainSize : 1;
+
+        const auto processChunk = [this, &driver, &func](const size_t start, const size_t end)
+        {
+            const Iterator last(driver.begin() + end, driver.begin() + end, m_storages, &driver);
+
+            for (Iterator it(driver.begin() + start, driver.begin() + end, m_storages, &driver); it != last; ++it)
+                invoke(func, it);
+        };
+
+        if (count <= grainSize || threadPool.getWorkersCount() == 0)
+        {
+            processChunk(0, count);
+            return;
+        }
+
+        Utility::TaskCounter counter;
+
+        for (size_t start = grainSize; start < count; start += grainSize)
+        {
+            threadPool.submit([&processChunk, start, end = std::min(start + grainSize, count)]
+            {
+                processChunk(start, end);
+            }, counter);
+        }
+
+        processChunk(0, grainSize);
+        threadPool.wait(counter);
+    }
+
+    template <class... Components>
+    template <typename Iterator, typename Func>
+    void SceneView<Components...>::dispatchArchetypeChunks(Utility::ThreadPool& threadPool, Func& func, size_t grainSize) const
+    {
+        using ChunkPosition = ArchetypeStorage::ChunkPosition;
+
+        grainSize = grainSize > 0 ? grainSize : 1;
+
+        // Split the matching archetypes on chunk boundaries - chunks are never shared between tasks
+        std::vector<ChunkPosition> bounds{ ChunkPosition{ 0, 0 } };
+        size_t                     rows = 0;
+
+        for (ArchetypeStorage::Index index = 0; index < m_archetypes->size(); ++index)
+        {
+            const Archetype& archetype  = m_archetypeStorage->getArchetype((*m_archetypes)[index]);
+            const size_t     chunkCount = archetype.getChunkCount();
+
+            for (ArchetypeStorage::Index chunk = 0; chunk < chunkCount; ++chunk)
+            {
+                rows += archetype.getChunkSize(chunk);
+
+                if (rows < grainSize)
+                    continue;
+
+                bounds.push_back(chunk + 1 < chunkCount ? ChunkPosition{ index, chunk + 1 } : ChunkPosition{ index + 1, 0 });
+                rows = 0;
+            }
+        }
+
+        if (const ChunkPosition last = { m_archetypes->size(), 0 }; bounds.back() != last)
+            bounds.push_back(last);
+
+        const size_t rangeCount = bounds.size() - 1;
+
+        const auto processRange = [this, &bounds, &func](const size_t range)
+        {
+            const Iterator last(*m_archetypeStorage, *m_archetypes, bounds[range + 1], bounds[range + 1], m_storages);
+
+            for (Iterator it(*m_archetypeStorage, *m_archetypes, bounds[range], bounds[range + 1], m_storages); it != last; ++it)
+                invoke(func, it);
+        };
+
+        if (rangeCount <= 1 || threadPool.getWorkersCount() == 0)
+        {
+            for (size_t range = 0; range < rangeCount; ++range)
+                processRange(range);
+
+            return;
+        }
+
+        Utility::TaskCounter counter;
+
+        for (size_t range = 1; range < rangeCount; ++range)
+        {
+            threadPool.submit([&processRange, range]
+            {
+                processRange(range);
+            }, counter);
+        }
+
+        processRange(0);
+        threadPool.wait(counter);
+    }
 }
@@ -0,0 +1,97 @@
+#pragma once
+#include "PantheonCore/ECS/SceneViewIterator.h"
+
+namespace PantheonCore::ECS
+{
+    template <bool IsConst, class... Components>
+    class SceneViewEach
+    {
+        using ViewIterator = SceneViewIterator<IsConst, Components...>;
+
+    public:
+        class Iterator
+        {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = decltype(std::tuple_cat(std::declval<std::tuple<Entity>>(),
+                std::declval<typename ViewIterator::ComponentsTuple>()));
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = value_type;
+
+            /**
+             * \brief Creates a default scene view each iterator
+             */
+            Iterator() = default;
+
+            /**
+             * \brief Creates an iterator yielding the entities and components of the given scene view iterator
+             * \param iterator The wrapped scene view iterator
+             */
+            explicit Iterator(ViewIterator iterator);
+
+            /**
+             * \brief Checks if the given iterator is equal to this one
+             * \param other The iterator to compare against
+             * \return True if the iterators are equal. False otherwise
+             */
+            bool operator==(const Iterator& other) const;
+
+            /**
+             * \brief Checks if the given iterator is not equal to this one
+             * \param other The iterator to compare against
+             * \return True if the iterators are not equal. False otherwise
+             */
+            bool operator!=(const Iterator& other) const;
+
+            /**
+             * \brief Dereferences the iterator
+             * \return A tuple containing the iterated entity followed by references to its components
+             */
+            reference operator*() const;
+
+            /**
+             * \brief Pre-increments the iterator
+             * \return A reference to the incremented iterator
+             */
+            Iterator& operator++();
+
+            /**
+             * \brief Post-increments the iterator
+             * \return A copy of the iterator before the increment
+             */
+            Iterator operator++(int);
+
+        private:
+            ViewIterator m_iterator;
+        };
+
+        using iterator = Iterator;
+        using const_iterator = Iterator;
+
+        /**
+         * \brief Creates an iterable range over the given scene view iterators
+         * \param begin The range's start position
+         * \param end The range's end position
+         */
+        SceneViewEach(ViewIterator begin, ViewIterator end);
+
+        /**
+         * \brief Gets an iterator to the start of the range
+         * \return An iterator to the start of the range
+         */
+        iterator begin() const;
+
+        /**
+         * \brief Gets an iterator to the end of the range
+         * \return An iterator to the end of the range
+         */
+        iterator end() const;
+
+    private:
+        ViewIterator m_begin;
+        ViewIterator m_end;
+    };
+}
+
+#include "PantheonCore/ECS/SceneViewEach.inl"
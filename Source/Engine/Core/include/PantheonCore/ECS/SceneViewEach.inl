@@ -0,0 +1,62 @@
+#pragma once
+#include "PantheonCore/ECS/SceneViewEach.h"
+
+namespace PantheonCore::ECS
+{
+    template <bool IsConst, class... Components>
+    SceneViewEach<IsConst, Components...>::Iterator::Iterator(ViewIterator iterator)
+        : m_iterator(iterator)
+    {
+    }
+
+    template <bool IsConst, class... Components>
+    bool SceneViewEach<IsConst, Components...>::Iterator::operator==(const Iterator& other) const
+    {
+        return m_iterator == other.m_iterator;
+    }
+
+    template <bool IsConst, class... Components>
+    bool SceneViewEach<IsConst, Components...>::Iterator::operator!=(const Iterator& other) const
+    {
+        return !(*this == other);
+    }
+
+    template <bool IsConst, class... Components>
+    typename SceneViewEach<IsConst, Components...>::Iterator::reference SceneViewEach<IsConst, Components...>::Iterator::operator*() const
+    {
+        return std::tuple_cat(std::make_tuple(*m_iterator), m_iterator.getComponents());
+    }
+
+    template <bool IsConst, class... Components>
+    typename SceneViewEach<IsConst, Components...>::Iterator& SceneViewEach<IsConst, Components...>::Iterator::operator++()
+    {
+        ++m_iterator;
+        return *this;
+    }
+
+    template <bool IsConst, class... Components>
+    typename SceneViewEach<IsConst, Components...>::Iterator SceneViewEach<IsConst, Components...>::Iterator::operator++(int)
+    {
+        Iterator tmp = *this;
+        ++(*this);
+        return tmp;
+    }
+
+    template <bool IsConst, class... Components>
+    SceneViewEach<IsConst, Components...>::SceneViewEach(ViewIterator begin, ViewIterator end)
+        : m_begin(begin), m_end(end)
+    {
+    }
+
+    template <bool IsConst, class... Components>
+    typename SceneViewEach<IsConst, Components...>::iterator SceneViewEach<IsConst, Components...>::begin() const
+    {
+        return Iterator(m_begin);
+    }
+
+    template <bool IsConst, class... Components>
+    typename SceneViewEach<IsConst, Components...>::iterator SceneViewEach<IsConst, Components...>::end() const
+    {
+        return Iterator(m_end);
+    }
+}
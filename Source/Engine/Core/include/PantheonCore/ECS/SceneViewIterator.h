@@ -1,8 +1,10 @@
 #pragma once
+#include "PantheonCore/ECS/ArchetypeStorage.h"
 #include "PantheonCore/ECS/ComponentStorage.h"
-#include "PantheonCore/ECS/EntityStorage.h"
 #include "PantheonCore/Utility/TypeTraits.h"
 
+#include <array>
+
 namespace PantheonCore::ECS
 {
     template <bool IsConst, class... Components>
@@ -11,8 +13,9 @@ namespace PantheonCore::ECS
         static_assert(sizeof...(Components) > 0);
         static_assert(!Utility::HasDuplicates<Components...>);
 
-        using iterator_type = std::conditional_t<IsConst, EntityStorage::const_iterator, EntityStorage::iterator>;
+        using iterator_type = SparseSet::const_iterator;
         using StorageTuple = std::tuple<ComponentStorage<Components>*...>;
+        using ChunkPosition = ArchetypeStorage::ChunkPosition;
 
     public:
         using iterator_category = std::forward_iterator_tag;
@@ -21,6 +24,11 @@ namespace PantheonCore::ECS
         using pointer = typename iterator_type::pointer;
         using reference = typename iterator_type::reference;
 
+        template <typename T>
+        using ComponentRef = std::conditional_t<IsConst, const T&, T&>;
+
+        using ComponentsTuple = std::tuple<ComponentRef<Components>...>;
+
         /**
          * \brief Creates a default scene view iterator
          */
@@ -31,8 +39,24 @@ namespace PantheonCore::ECS
          * \param current The start iterator
          * \param end The end iterator
          * \param storages The storages this iterator cares about
+         * \param driver The iterated owners set (skipped during membership checks)
+         * \param since The oldest change tick of the entities to iterate over. 0 to iterate over all matching entities
          */
-        SceneViewIterator(iterator_type current, iterator_type end, const StorageTuple& storages);
+        SceneViewIterator(iterator_type current, iterator_type end, const StorageTuple& storages, const SparseSet* driver,
+            Tick since = 0);
+
+        /**
+         * \brief Creates a scene view iterator walking the chunks of the given archetypes between the given positions.
+         * Components stored in archetypes are read from the chunks' columns and the other ones from the given storages
+         * \param archetypes The scene's archetype storage
+         * \param matches The indices of the iterated archetypes
+         * \param current The start chunk position
+         * \param end The end chunk position
+         * \param storages The storages this iterator cares about. Nullptr for the components stored in archetypes
+         * \param since The oldest change tick of the entities to iterate over. 0 to iterate over all matching entities
+         */
+        SceneViewIterator(ArchetypeStorage& archetypes, const std::vector<ArchetypeStorage::Index>& matches,
+            ChunkPosition current, ChunkPosition end, const StorageTuple& storages, Tick since = 0);
 
         /**
          * \brief Creates a copy of the given scene view iterator
@@ -103,19 +127,79 @@ namespace PantheonCore::ECS
          */
         SceneViewIterator operator++(int);
 
+        /**
+         * \brief Gets the iterated entity's components from the dense indices resolved while checking its validity
+         * \return A tuple of references to the iterated entity's components
+         */
+        ComponentsTuple getComponents() const;
+
     private:
-        const StorageTuple* m_storages;
-        iterator_type       m_iterator;
-        iterator_type       m_end;
+        const StorageTuple*                                 m_storages;
+        const SparseSet*                                    m_driver;
+        iterator_type                                       m_iterator;
+        iterator_type                                       m_end;
+        std::array<SparseSet::Index, sizeof...(Components)> m_indices{};
+        Tick                                                m_since = 0;
+
+        ArchetypeStorage*                                   m_archetypeStorage = nullptr;
+        const std::vector<ArchetypeStorage::Index>*         m_archetypes       = nullptr;
+        ChunkPosition                                       m_chunk{};
+        ChunkPosition                                       m_endChunk{};
+        const Entity*                                       m_chunkEntities    = nullptr;
+        size_t                                              m_slot             = 0;
+        size_t                                              m_slotCount        = 0;
+        std::array<std::byte*, sizeof...(Components)>       m_columns{};
 
         /**
-         * \brief Checks if the given entity is valid (not NULL_ENTITY & has all of the requested components)
+         * \brief Caches the owners and component columns of the current chunk and moves to its first slot
+         */
+        void loadChunk();
+
+        /**
+         * \brief Caches the current chunk's columns of the components stored in archetypes
+         * \tparam Indices The components' indices
+         * \param archetype The current chunk's archetype
+         */
+        template <size_t... Indices>
+        void loadColumns(Archetype& archetype, std::index_sequence<Indices...>);
+
+        /**
+         * \brief Moves to the first valid entity at or after the current chunk slot
+         */
+        void seekChunks();
+
+        /**
+         * \brief Checks if the given entity has all of the requested components and caches their dense indices
          * \tparam Index The checked type's index
          * \param entity The checked entity
          * \return True if the entity is valid. False otherwise
          */
         template <size_t Index = 0>
         bool isValid(value_type entity);
+
+        /**
+         * \brief Checks if any of the iterated entity's components with change tracking enabled changed since the filter tick
+         * \tparam Indices The components' indices
+         * \return True if one of the tracked components changed. False otherwise
+         */
+        template <size_t... Indices>
+        bool hasChanged(std::index_sequence<Indices...>) const;
+
+        /**
+         * \brief Gets the iterated entity's components from the cached dense indices
+         * \tparam Indices The components' indices
+         * \return A tuple of references to the iterated entity's components
+         */
+        template <size_t... Indices>
+        ComponentsTuple getComponents(std::index_sequence<Indices...>) const;
+
+        /**
+         * \brief Gets the iterated entity's component of the given index
+         * \tparam Index The component's index
+         * \return A reference to the iterated entity's component
+         */
+        template <size_t Index>
+        ComponentRef<std::tuple_element_t<Index, std::tuple<Components...>>> getComponent() const;
     };
 }
 
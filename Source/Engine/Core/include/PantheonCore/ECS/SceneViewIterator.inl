@@ -5,16 +5,30 @@ namespace PantheonCore::ECS
 {
     template <bool IsConst, class... Components>
     SceneViewIterator<IsConst, Components...>::SceneViewIterator(
-        iterator_type current, iterator_type end, const StorageTuple& storages)
-        : m_storages(&storages), m_iterator(current), m_end(end)
+        iterator_type current, iterator_type end, const StorageTuple& storages, const SparseSet* driver, const Tick since)
+        : m_storages(&storages), m_driver(driver), m_iterator(current), m_end(end), m_since(since)
     {
         while (m_iterator != m_end && !isValid(*m_iterator))
             ++m_iterator;
     }
 
+    template <bool IsConst, class... Components>
+    SceneViewIterator<IsConst, Components...>::SceneViewIterator(ArchetypeStorage& archetypes,
+        const std::vector<ArchetypeStorage::Index>& matches, const ChunkPosition current, const ChunkPosition end,
+        const StorageTuple& storages, const Tick since)
+        : m_storages(&storages), m_driver(nullptr), m_since(since), m_archetypeStorage(&archetypes), m_archetypes(&matches),
+        m_chunk(current), m_endChunk(end)
+    {
+        loadChunk();
+        seekChunks();
+    }
+
     template <bool IsConst, class... Components>
     bool SceneViewIterator<IsConst, Components...>::operator==(const SceneViewIterator& other) const
     {
+        if (m_archetypes)
+            return m_chunk == other.m_chunk && m_slot == other.m_slot;
+
         return m_iterator == other.m_iterator;
     }
 
@@ -27,6 +41,9 @@ namespace PantheonCore::ECS
     template <bool IsConst, class... Components>
     typename SceneViewIterator<IsConst, Components...>::reference SceneViewIterator<IsConst, Components...>::operator*() const
     {
+        if (m_archetypes)
+            return m_chunkEntities[m_slot];
+
         return *m_iterator;
     }
 
@@ -39,6 +56,13 @@ namespace PantheonCore::ECS
     template <bool IsConst, class... Components>
     SceneViewIterator<IsConst, Components...>& SceneViewIterator<IsConst, Components...>::operator++()
     {
+        if (m_archetypes)
+        {
+            ++m_slot;
+            seekChunks();
+            return *this;
+        }
+
         while (++m_iterator != m_end && !isValid(*m_iterator))
         {
             // Do nothing
@@ -55,18 +79,127 @@ namespace PantheonCore::ECS
         return tmp;
     }
 
+    template <bool IsConst, class... Components>
+    typename SceneViewIterator<IsConst, Components...>::ComponentsTuple SceneViewIterator<IsConst, Components...>::getComponents() const
+    {
+        ASSERT(m_archetypes ? m_chunk != m_endChunk : m_iterator != m_end,
+            "Unable to get components of an out of range scene view iterator");
+        return getComponents(std::index_sequence_for<Components...>{});
+    }
+
     template <bool IsConst, class... Components>
     template <size_t Index>
     bool SceneViewIterator<IsConst, Components...>::isValid(const value_type entity)
     {
-        if (entity == NULL_ENTITY)
-            return false;
+        // Components stored in the iterated archetype are always owned by the entity
+        if (!m_columns[Index])
+        {
+            const auto* storage = std::get<Index>(*m_storages);
+
+            if (!storage)
+                return false;
 
-        const auto* storage = std::get<Index>(*m_storages);
+            const SparseSet&  owners = storage->getOwners();
+            SparseSet::Index& index  = m_indices[Index];
+
+            index = &owners == m_driver ? static_cast<SparseSet::Index>(m_iterator - owners.begin()) : owners.find(entity);
+
+            if (index == SparseSet::INVALID_INDEX)
+                return false;
+        }
 
         if constexpr (Index == sizeof...(Components) - 1)
-            return storage && storage->contains(entity);
+            return m_since == 0 || hasChanged(std::index_sequence_for<Components...>{});
         else
-            return storage && storage->contains(entity) && isValid<Index + 1>(entity);
+            return isValid<Index + 1>(entity);
+    }
+
+    template <bool IsConst, class... Components>
+    template <size_t... Indices>
+    bool SceneViewIterator<IsConst, Components...>::hasChanged(std::index_sequence<Indices...>) const
+    {
+        const auto isChanged = [this](const auto* storage, const SparseSet::Index index)
+        {
+            return storage && storage->isTrackingChanges() && storage->getChangeTick(index) >= m_since;
+        };
+
+        return (isChanged(std::get<Indices>(*m_storages), m_indices[Indices]) || ...);
+    }
+
+    template <bool IsConst, class... Components>
+    template <size_t... Indices>
+    typename SceneViewIterator<IsConst, Components...>::ComponentsTuple SceneViewIterator<IsConst, Components...>::getComponents(
+        std::index_sequence<Indices...>) const
+    {
+        return ComponentsTuple(getComponent<Indices>()...);
+    }
+
+    template <bool IsConst, class... Components>
+    template <size_t Index>
+    typename SceneViewIterator<IsConst, Components...>::template ComponentRef<std::tuple_element_t<Index, std::tuple<Components...>>>
+    SceneViewIterator<IsConst, Components...>::getComponent() const
+    {
+        using ComponentT = std::tuple_element_t<Index, std::tuple<Components...>>;
+
+        if (m_columns[Index])
+            return reinterpret_cast<ComponentT*>(m_columns[Index])[m_slot];
+
+        return (*std::get<Index>(*m_storages))[m_indices[Index]];
+    }
+
+    template <bool IsConst, class... Components>
+    void SceneViewIterator<IsConst, Components...>::loadChunk()
+    {
+        m_slot      = 0;
+        m_slotCount = 0;
+
+        if (m_chunk == m_endChunk || m_chunk.m_archetype >= m_archetypes->size())
+            return;
+
+        Archetype& archetype = m_archetypeStorage->getArchetype((*m_archetypes)[m_chunk.m_archetype]);
+
+        if (m_chunk.m_chunk >= archetype.getChunkCount())
+            return;
+
+        m_slotCount     = archetype.getChunkSize(m_chunk.m_chunk);
+        m_chunkEntities = archetype.getEntities(m_chunk.m_chunk);
+
+        loadColumns(archetype, std::index_sequence_for<Components...>{});
+    }
+
+    template <bool IsConst, class... Components>
+    template <size_t... Indices>
+    void SceneViewIterator<IsConst, Components...>::loadColumns(Archetype& archetype, std::index_sequence<Indices...>)
+    {
+        // Components without a storage are the ones stored in archetypes
+        const auto getColumn = [this, &archetype](const auto* storage, const Utility::TypeId typeId) -> std::byte*
+        {
+            return storage ? nullptr : archetype.getColumn(m_chunk.m_chunk, archetype.getColumnIndex(typeId));
+        };
+
+        ((m_columns[Indices] = getColumn(std::get<Indices>(*m_storages), ComponentRegistry::getTypeId<Components>())), ...);
+    }
+
+    template <bool IsConst, class... Components>
+    void SceneViewIterator<IsConst, Components...>::seekChunks()
+    {
+        while (m_chunk != m_endChunk)
+        {
+            if (m_slot < m_slotCount)
+            {
+                if (isValid(m_chunkEntities[m_slot]))
+                    return;
+
+                ++m_slot;
+                continue;
+            }
+
+            const Archetype& archetype = m_archetypeStorage->getArchetype((*m_archetypes)[m_chunk.m_archetype]);
+
+            if (++m_chunk.m_chunk >= archetype.getChunkCount())
+                m_chunk = { m_chunk.m_archetype + 1, 0 };
+
+            loadChunk();
+        }
     }
 }
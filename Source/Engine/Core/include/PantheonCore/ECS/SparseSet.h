@@ -0,0 +1,158 @@
+#pragma once
+#include "PantheonCore/ECS/Entity.h"
+
+#include <limits>
+#include <vector>
+
+namespace PantheonCore::ECS
+{
+    class SparseSet
+    {
+    public:
+        using Index = size_t;
+        using const_iterator = std::vector<Entity>::const_iterator;
+
+        static constexpr Index  INVALID_INDEX = std::numeric_limits<Index>::max();
+        static constexpr size_t PAGE_SIZE     = 4096;
+
+        /**
+         * \brief Creates an empty sparse set
+         */
+        SparseSet() = default;
+
+        /**
+         * \brief Creates a copy of the given sparse set
+         * \param other The sparse set to copy
+         */
+        SparseSet(const SparseSet& other) = default;
+
+        /**
+         * \brief Creates a move copy of the given sparse set
+         * \param other The sparse set to move
+         */
+        SparseSet(SparseSet&& other) noexcept = default;
+
+        /**
+         * \brief Destroys the sparse set
+         */
+        ~SparseSet() = default;
+
+        /**
+         * \brief Assigns a copy of the given sparse set to this one
+         * \param other The sparse set to copy
+         * \return A reference to the modified sparse set
+         */
+        SparseSet& operator=(const SparseSet& other) = default;
+
+        /**
+         * \brief Moves the given sparse set into this one
+         * \param other The sparse set to move
+         * \return A reference to the modified sparse set
+         */
+        SparseSet& operator=(SparseSet&& other) noexcept = default;
+
+        /**
+         * \brief Gets the entity stored at the given dense index
+         * \param index The target dense index
+         * \return The entity stored at the given dense index
+         */
+        Entity operator[](Index index) const;
+
+        /**
+         * \brief Checks if the given entity is in the set
+         * \param entity The entity to check for
+         * \return True if the entity is in the set. False otherwise
+         */
+        bool contains(Entity entity) const;
+
+        /**
+         * \brief Finds the dense index of the given entity
+         * \param entity The searched entity
+         * \return The entity's dense index on success. INVALID_INDEX otherwise
+         */
+        Index find(Entity entity) const;
+
+        /**
+         * \brief Appends the given entity to the set
+         * \param entity The entity to add
+         * \return The added entity's dense index
+         */
+        Index insert(Entity entity);
+
+        /**
+         * \brief Removes the entity at the given dense index by swapping it with the last one
+         * \param index The removed entity's dense index
+         */
+        void erase(Index index);
+
+        /**
+         * \brief Swaps the entities stored at the given dense indices
+         * \param first The first entity's dense index
+         * \param second The second entity's dense index
+         */
+        void swap(Index first, Index second);
+
+        /**
+         * \brief Removes all entities from the set
+         */
+        void clear();
+
+        /**
+         * \brief Replaces the set's content with the given packed entities array, keeping the allocated pages
+         * \param entities A pointer to the first entity
+         * \param count The number of entities
+         */
+        void assign(const Entity* entities, size_t count);
+
+        /**
+         * \brief Reserves the given number of entities
+         * \param count The number of entities to reserve
+         */
+        void reserve(size_t count);
+
+        /**
+         * \brief Gets the current number of entities
+         * \return The current number of entities
+         */
+        size_t size() const;
+
+        /**
+         * \brief Checks whether the set is empty or not
+         * \return True if the set is empty. False otherwise
+         */
+        bool empty() const;
+
+        /**
+         * \brief Gets a pointer to the packed entities array
+         * \return A pointer to the packed entities array
+         */
+        const Entity* data() const;
+
+        /**
+         * \brief Gets a constant iterator to the start of the packed entities array
+         * \return A constant iterator to the start of the packed entities array
+         */
+        const_iterator begin() const;
+
+        /**
+         * \brief Gets a constant iterator to the end of the packed entities array
+         * \return A constant iterator to the end of the packed entities array
+         */
+        const_iterator end() const;
+
+    private:
+        using Page = std::vector<Index>;
+
+        std::vector<Page>   m_sparse;
+        std::vector<Entity> m_dense;
+
+        /**
+         * \brief Gets the sparse slot of the given entity, allocating its page if necessary
+         * \param entity The target entity
+         * \return A reference to the entity's sparse slot
+         */
+        Index& assure(Entity entity);
+    };
+}
+
+#include "PantheonCore/ECS/SparseSet.inl"
@@ -0,0 +1,135 @@
+#pragma once
+#include "PantheonCore/ECS/SparseSet.h"
+
+#include "PantheonCore/Debug/Assertion.h"
+
+namespace PantheonCore::ECS
+{
+    inline Entity SparseSet::operator[](const Index index) const
+    {
+        return m_dense[index];
+    }
+
+    inline bool SparseSet::contains(const Entity entity) const
+    {
+        return find(entity) != INVALID_INDEX;
+    }
+
+    inline SparseSet::Index SparseSet::find(const Entity entity) const
+    {
+        const Entity::Id entityIndex = entity.getIndex();
+        const size_t     pageIndex   = entityIndex / PAGE_SIZE;
+
+        if (pageIndex >= m_sparse.size() || m_sparse[pageIndex].empty())
+            return INVALID_INDEX;
+
+        const Index index = m_sparse[pageIndex][entityIndex % PAGE_SIZE];
+        return index != INVALID_INDEX && m_dense[index] == entity ? index : INVALID_INDEX;
+    }
+
+    inline SparseSet::Index SparseSet::insert(const Entity entity)
+    {
+        ASSERT(entity != NULL_ENTITY, "Unable to add null entity to sparse set");
+        ASSERT(!contains(entity), "Entity %llu is already in the sparse set", entity.getIndex());
+
+        const Index index = m_dense.size();
+
+        assure(entity) = index;
+        m_dense.push_back(entity);
+
+        return index;
+    }
+
+    inline void SparseSet::erase(const Index index)
+    {
+        ASSERT(index < m_dense.size());
+
+        const Entity::Id removedIndex = m_dense[index].getIndex();
+        const Entity     last         = m_dense.back();
+        const Entity::Id lastIndex    = last.getIndex();
+
+        m_dense[index] = last;
+
+        m_sparse[lastIndex / PAGE_SIZE][lastIndex % PAGE_SIZE]       = index;
+        m_sparse[removedIndex / PAGE_SIZE][removedIndex % PAGE_SIZE] = INVALID_INDEX;
+
+        m_dense.pop_back();
+    }
+
+    inline void SparseSet::swap(const Index first, const Index second)
+    {
+        ASSERT(first < m_dense.size() && second < m_dense.size());
+
+        const Entity::Id firstIndex  = m_dense[first].getIndex();
+        const Entity::Id secondIndex = m_dense[second].getIndex();
+
+        std::swap(m_dense[first], m_dense[second]);
+
+        m_sparse[firstIndex / PAGE_SIZE][firstIndex % PAGE_SIZE]   = second;
+        m_sparse[secondIndex / PAGE_SIZE][secondIndex % PAGE_SIZE] = first;
+    }
+
+    inline void SparseSet::clear()
+    {
+        m_sparse.clear();
+        m_dense.clear();
+    }
+
+    inline void SparseSet::assign(const Entity* entities, const size_t count)
+    {
+        // Only reset the slots in use - the pages stay allocated for the new entities
+        for (const Entity entity : m_dense)
+            m_sparse[entity.getIndex() / PAGE_SIZE][entity.getIndex() % PAGE_SIZE] = INVALID_INDEX;
+
+        m_dense.assign(entities, entities + count);
+
+        for (Index index = 0; index < count; ++index)
+            assure(m_dense[index]) = index;
+    }
+
+    inline void SparseSet::reserve(const size_t count)
+    {
+        m_dense.reserve(count);
+    }
+
+    inline size_t SparseSet::size() const
+    {
+        return m_dense.size();
+    }
+
+    inline bool SparseSet::empty() const
+    {
+        return m_dense.empty();
+    }
+
+    inline const Entity* SparseSet::data() const
+    {
+        return m_dense.data();
+    }
+
+    inline SparseSet::const_iterator SparseSet::begin() const
+    {
+        return m_dense.begin();
+    }
+
+    inline SparseSet::const_iterator SparseSet::end() const
+    {
+        return m_dense.end();
+    }
+
+    inline SparseSet::Index& SparseSet::assure(const Entity entity)
+    {
+        const Entity::Id entityIndex = entity.getIndex();
+        const size_t     pageIndex   = entityIndex / PAGE_SIZE;
+
+        if (pageIndex >= m_sparse.size())
+            m_sparse.resize(pageIndex + 1);
+
+        Page& page = m_sparse[pageIndex];
+
+        if (page.empty())
+            page.resize(PAGE_SIZE, INVALID_INDEX);
+
+        return page[entityIndex % PAGE_SIZE];
+    }
+}
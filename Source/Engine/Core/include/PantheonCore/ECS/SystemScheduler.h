@@ -0,0 +1,183 @@
+#pragma once
+#include "PantheonCore/ECS/ISystem.h"
+#include "PantheonCore/Utility/TaskCounter.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace PantheonCore::Utility
+{
+    class ThreadPool;
+}
+
+namespace PantheonCore::ECS
+{
+    /**
+     * \brief Runs a set of systems on a scene each frame.\n
+     * Systems are ordered as a dependency graph: a system depends on every previously added system whose access
+     * conflicts with its own, so conflicting systems always run in registration order while independent ones can run
+     * concurrently on a thread pool. The scene is frozen for the duration of the update (see SceneAccess) - the storages
+     * of every accessed component type should be registered (Scene::registerStorages) before the first update
+     */
+    class SystemScheduler
+    {
+    public:
+        using SystemId = size_t;
+
+        /**
+         * \brief Creates an empty system scheduler
+         */
+        SystemScheduler() = default;
+
+        /**
+         * \brief Disable system scheduler copy
+         */
+        SystemScheduler(const SystemScheduler&) = delete;
+
+        /**
+         * \brief Disable system scheduler move
+         */
+        SystemScheduler(SystemScheduler&&) = delete;
+
+        /**
+         * \brief Destroys the system scheduler and its systems
+         */
+        ~SystemScheduler() = default;
+
+        /**
+         * \brief Disable system scheduler copy
+         */
+        SystemScheduler& operator=(const SystemScheduler&) = delete;
+
+        /**
+         * \brief Disable system scheduler move
+         */
+        SystemScheduler& operator=(SystemScheduler&&) = delete;
+
+        /**
+         * \brief Creates a system of the given type and adds it to the scheduler
+         * \tparam T The system's type
+         * \tparam Args The system's construction parameters
+         * \param args The system's construction parameters
+         * \return A reference to the added system
+         */
+        template <typename T, typename... Args>
+        T& addSystem(Args&&... args);
+
+        /**
+         * \brief Finds the first system of the given type
+         * \tparam T The searched system's type
+         * \return A pointer to the found system on success. Nullptr otherwise
+         */
+        template <typename T>
+        T* getSystem();
+
+        /**
+         * \brief Gets the system with the given id
+         * \param id The system's id (i.e. its registration index)
+         * \return A reference to the system
+         */
+        ISystem& getSystem(SystemId id);
+
+        /**
+         * \brief Gets the number of systems in the scheduler
+         * \return The number of systems in the scheduler
+         */
+        size_t getSystemCount() const;
+
+        /**
+         * \brief Gets the ids of the systems that must complete before the given one can start
+         * \param id The system's id
+         * \return The system's dependencies
+         */
+        const std::vector<SystemId>& getDependencies(SystemId id) const;
+
+        /**
+         * \brief Gets the duration of the given system's last update
+         * \param id The system's id
+         * \return The system's last update time in seconds
+         */
+        float getUpdateTime(SystemId id) const;
+
+        /**
+         * \brief Gets the duration of the last scheduler update
+         * \return The last frame's total update time in seconds
+         */
+        float getFrameTime() const;
+
+        /**
+         * \brief Updates every system on the calling thread, in registration order, then advances the scene's tick so that
+         * the frame's changes can be told apart from the next one's (see Scene::advanceTick)
+         * \param scene The updated scene
+         * \param deltaTime The time elapsed since the last update
+         */
+        void update(Scene& scene, float deltaTime);
+
+        /**
+         * \brief Updates every system, running independent systems concurrently on the given thread pool,
+         * then advances the scene's tick (see the sequential overload).
+         * The calling thread executes the pool's queued tasks until all the systems are done, so systems can dispatch nested
+         * work to the same pool (e.g. SceneView::parallelEach). Falls back to a sequential update if the pool has no workers
+         * \param scene The updated scene
+         * \param deltaTime The time elapsed since the last update
+         * \param threadPool The thread pool on which the systems should run
+         */
+        void update(Scene& scene, float deltaTime, Utility::ThreadPool& threadPool);
+
+        /**
+         * \brief Removes all the systems from the scheduler
+         */
+        void clear();
+
+    private:
+        struct SystemNode
+        {
+            std::unique_ptr<ISystem> m_system;
+            SceneAccess              m_access;
+            std::vector<SystemId>    m_dependencies;
+            std::vector<SystemId>    m_dependents;
+            float                    m_updateTime = 0.f;
+        };
+
+        std::vector<SystemNode>            m_systems;
+        std::vector<std::atomic<uint32_t>> m_pendingCounts;
+        Utility::TaskCounter               m_counter;
+        float                              m_frameTime = 0.f;
+
+        /**
+         * \brief Adds the given system to the dependency graph
+         * \param system The added system
+         */
+        void addNode(std::unique_ptr<ISystem> system);
+
+        /**
+         * \brief Updates the given system and records its update time
+         * \param node The updated system's node
+         * \param scene The updated scene
+         * \param deltaTime The time elapsed since the last update
+         */
+        static void runSystem(SystemNode& node, Scene& scene, float deltaTime);
+
+        /**
+         * \brief Submits a task executing the given ready system to the given thread pool
+         * \param id The system's id
+         * \param scene The updated scene
+         * \param deltaTime The time elapsed since the last update
+         * \param threadPool The thread pool on which the system should run
+         */
+        void schedule(SystemId id, Scene& scene, float deltaTime, Utility::ThreadPool& threadPool);
+
+        /**
+         * \brief Updates the given system then schedules the dependents it was the last dependency of.
+         * The first ready dependent runs on the current thread to avoid a round trip through the pool
+         * \param id The updated system's id
+         * \param scene The updated scene
+         * \param deltaTime The time elapsed since the last update
+         * \param threadPool The thread pool on which the dependents should run
+         */
+        void execute(SystemId id, Scene& scene, float deltaTime, Utility::ThreadPool& threadPool);
+    };
+}
+
+#include "PantheonCore/ECS/SystemScheduler.inl"
@@ -0,0 +1,31 @@
+#pragma once
+#include "PantheonCore/ECS/SystemScheduler.h"
+
+namespace PantheonCore::ECS
+{
+    template <typename T, typename... Args>
+    T& SystemScheduler::addSystem(Args&&... args)
+    {
+        static_assert(std::is_base_of_v<ISystem, T>);
+
+        auto system = std::make_unique<T>(std::forward<Args>(args)...);
+        T&   ref    = *system;
+
+        addNode(std::move(system));
+        return ref;
+    }
+
+    template <typename T>
+    T* SystemScheduler::getSystem()
+    {
+        static_assert(std::is_base_of_v<ISystem, T>);
+
+        for (SystemNode& node : m_systems)
+        {
+            if (T* system = dynamic_cast<T*>(node.m_system.get()))
+                return system;
+        }
+
+        return nullptr;
+    }
+}
@@ -0,0 +1,236 @@
+#pragma once
+#include "PantheonCore/ECS/ISystem.h"
+#include "PantheonCore/ECS/SparseSet.h"
+#include "PantheonCore/ECS/Tick.h"
+#include "PantheonCore/Eventing/Event.h"
+#include "PantheonCore/Utility/TaskCounter.h"
+
+#include <Matrix/Matrix4.h>
+
+#include <atomic>
+#include <vector>
+
+namespace LibMath
+{
+    class Transform;
+}
+
+namespace PantheonCore::Utility
+{
+    class ThreadPool;
+}
+
+namespace PantheonCore::ECS
+{
+    template <class T>
+    class ComponentStorage;
+
+    /**
+     * \brief Computes the world matrices of a scene's transforms.\n
+     * The scene's transforms are kept in a dense array in depth-first order: parents always precede their children and
+     * each subtree occupies a contiguous range. Transform components are linked to their closest ancestor owning a
+     * transform, entities without a transform being skipped. Each update recomputes the world matrices of the modified
+     * transforms' subtrees in a single linear pass over the array.\n
+     * Modifications are detected through the transform storage's change tracking (enabled by the system): transforms
+     * modified in place must be marked as dirty (Scene::markDirty) for their world matrix to be updated.
+     * Each update consumes the changes stamped after the tick of the previous update, so the scene's tick must be advanced
+     * exactly once per frame, after the system's update and before the next frame's modifications: SystemScheduler::update
+     * does so once the scene is unfrozen, and applications updating the system by hand must call Scene::advanceTick after it.
+     * Transforms modified during the same frame after the update (e.g. by a system registered after this one) share the
+     * consumed tick and are not picked up - such systems should be registered before the transform system.
+     * Hierarchy changes are detected through the storages' events and rebuild the array without per-node allocations.\n
+     * When given a thread pool, the root subtrees are split into contiguous batches of similar node counts which are
+     * propagated concurrently by the pool's workers and the updating thread
+     */
+    class TransformSystem final : public ISystem
+    {
+    public:
+        using Index = SparseSet::Index;
+
+        static constexpr Index INVALID_INDEX = SparseSet::INVALID_INDEX;
+
+        /**
+         * \brief The minimum number of transforms in a batch of root subtrees propagated by a single thread
+         */
+        static constexpr Index MIN_PARTITION_SIZE = 4096;
+
+        /**
+         * \brief The number of batches of root subtrees to create per thread when propagating in parallel
+         */
+        static constexpr size_t PARTITIONS_PER_THREAD = 4;
+
+        /**
+         * \brief Creates a transform system for the given scene. The scene must outlive the system
+         * \param scene The scene whose transforms should be updated by the system
+         * \param threadPool The thread pool on which the world matrices should be computed. Nullptr to update sequentially
+         */
+        explicit TransformSystem(Scene& scene, Utility::ThreadPool* threadPool = nullptr);
+
+        /**
+         * \brief Disable transform system copy
+         */
+        TransformSystem(const TransformSystem&) = delete;
+
+        /**
+         * \brief Disable transform system move
+         */
+        TransformSystem(TransformSystem&&) = delete;
+
+        /**
+         * \brief Destroys the transform system
+         */
+        ~TransformSystem() override;
+
+        /**
+         * \brief Disable transform system copy
+         */
+        TransformSystem& operator=(const TransformSystem&) = delete;
+
+        /**
+         * \brief Disable transform system move
+         */
+        TransformSystem& operator=(TransformSystem&&) = delete;
+
+        /**
+         * \brief Gets the component types the system accesses
+         * \return The system's scene access declaration
+         */
+        SceneAccess getAccess() const override;
+
+        /**
+         * \brief Updates the world matrices of the modified transforms and their children
+         * \param scene The updated scene. Must be the system's scene
+         * \param deltaTime The time elapsed since the last update
+         */
+        void update(Scene& scene, float deltaTime) override;
+
+        /**
+         * \brief Forces the next update to rebuild the transforms array and recompute every world matrix
+         */
+        void invalidate();
+
+        /**
+         * \brief Sets the thread pool on which the world matrices should be computed
+         * \param threadPool The thread pool to use. Nullptr to update sequentially
+         */
+        void setThreadPool(Utility::ThreadPool* threadPool);
+
+        /**
+         * \brief Gets the number of batches of root subtrees the transforms array is split into
+         * \return The number of batches that can be propagated concurrently
+         */
+        size_t getPartitionCount() const;
+
+        /**
+         * \brief Finds the world matrix computed for the given entity's transform during the last update
+         * \param entity The transform's owner
+         * \return A pointer to the entity's world matrix on success. Nullptr otherwise
+         */
+        const LibMath::Matrix4* findWorldMatrix(Entity entity) const;
+
+        /**
+         * \brief Gets the index of the given entity's transform in the depth-first transforms array
+         * \param entity The transform's owner
+         * \return The transform's index on success. INVALID_INDEX otherwise
+         */
+        Index find(Entity entity) const;
+
+        /**
+         * \brief Gets the number of transforms in the array
+         * \return The number of transforms updated by the system
+         */
+        size_t getCount() const;
+
+        /**
+         * \brief Gets the number of world matrices computed during the last update
+         * \return The number of world matrices computed during the last update
+         */
+        size_t getUpdatedCount() const;
+
+    private:
+        struct Node
+        {
+            Entity m_entity;
+            Index  m_parent;
+            Index  m_subtreeSize;
+        };
+
+        using ListenerId = Eventing::IEvent::ListenerId;
+
+        /**
+         * \brief The shared state of a parallel propagation. Its tasks are tracked by the counter and all complete
+         * before the update returns
+         */
+        struct PropagationJob
+        {
+            TransformSystem*                            m_system         = nullptr;
+            const ComponentStorage<LibMath::Transform>* m_transforms     = nullptr;
+            size_t                                      m_partitionCount = 0;
+            std::atomic<size_t>                         m_nextPartition;
+            std::atomic<size_t>                         m_updatedCount;
+            std::atomic<bool>                           m_hasMissingTransforms;
+            Utility::TaskCounter                        m_counter;
+
+            /**
+             * \brief Propagates the remaining partitions until none is left
+             */
+            void run();
+        };
+
+        Scene*                        m_scene;
+        Utility::ThreadPool*          m_threadPool;
+        std::vector<Node>             m_nodes;
+        std::vector<LibMath::Matrix4> m_worldMatrices;
+        std::vector<uint8_t>          m_dirtyFlags;
+        std::vector<Index>            m_lookup;
+        std::vector<Node>             m_pending;
+        std::vector<Index>            m_partitions;
+        PropagationJob                m_job;
+        Tick                          m_lastTick;
+        size_t                        m_updatedCount;
+        bool                          m_isStructureDirty;
+
+        ListenerId m_hierarchyAddListener;
+        ListenerId m_hierarchyRemoveListener;
+        ListenerId m_hierarchyChangeListener;
+        ListenerId m_transformAddListener;
+        ListenerId m_transformRemoveListener;
+
+        /**
+         * \brief Rebuilds the depth-first transforms array from the scene's hierarchy
+         */
+        void rebuild();
+
+        /**
+         * \brief Adds the given hierarchy's transforms to the array in depth-first order
+         * \param root The hierarchy's root entity
+         */
+        void addSubtree(Entity root);
+
+        /**
+         * \brief Flags the transforms modified since the last update as dirty
+         */
+        void gatherChanges();
+
+        /**
+         * \brief Splits the root subtrees into batches of similar node counts
+         */
+        void buildPartitions();
+
+        /**
+         * \brief Recomputes the world matrices of the dirty subtrees
+         */
+        void propagate();
+
+        /**
+         * \brief Recomputes the world matrices of the dirty subtrees in the given range of the transforms array
+         * \param transforms The scene's transforms storage
+         * \param begin The first index of the range. Must be the start of a root subtree
+         * \param end The index after the range's last transform. Must be the end of a root subtree
+         * \param hasMissingTransforms Set to true if a transform in the range was removed from the scene
+         * \return The number of recomputed world matrices
+         */
+        size_t propagate(const ComponentStorage<LibMath::Transform>& transforms, Index begin, Index end,
+                         bool& hasMissingTransforms);
+    };
+}
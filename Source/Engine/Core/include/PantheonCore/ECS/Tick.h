@@ -0,0 +1,10 @@
+#pragma once
+#include <cstdint>
+
+namespace PantheonCore::ECS
+{
+    /**
+     * \brief A scene change tracking timestamp. Components modified while the scene is at a given tick are stamped with it
+     */
+    using Tick = uint64_t;
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "PantheonCore/Eventing/Event.h"
 
@@ -10,7 +11,7 @@ namespace PantheonCore::Eventing
     {
     public:
         using EventPtr = std::unique_ptr<IEvent>;
-        using EventMap = std::unordered_map<size_t, EventPtr>;
+        using EventMap = std::vector<EventPtr>;
 
         /**
          * \brief Subscribes the given action to the provided event type
@@ -45,6 +46,14 @@ namespace PantheonCore::Eventing
 
     private:
         EventMap m_events;
+
+        /**
+         * \brief Gets the event of the given type if it has been subscribed to
+         * \tparam EventType The searched event's type
+         * \return A pointer to the found event on success. Nullptr otherwise
+         */
+        template <typename EventType>
+        EventType* find() const;
     };
 }
 
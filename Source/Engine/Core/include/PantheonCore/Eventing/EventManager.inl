@@ -2,8 +2,9 @@
 
 #include "PantheonCore/Eventing/EventManager.h"
 
+#include "PantheonCore/Utility/TypeId.h"
+
 #include <type_traits>
-#include <ranges>
 
 namespace PantheonCore::Eventing
 {
@@ -12,12 +13,15 @@ namespace PantheonCore::Eventing
     {
         static_assert(std::is_base_of_v<IEvent, EventType>);
 
-        const size_t typeHash = typeid(EventType).hash_code();
+        const Utility::TypeId typeId = Utility::TypeIdGenerator<IEvent>::get<EventType>();
+
+        if (typeId >= m_events.size())
+            m_events.resize(typeId + 1);
 
-        if (!m_events.contains(typeHash))
-            m_events[typeHash] = std::make_unique<EventType>();
+        if (!m_events[typeId])
+            m_events[typeId] = std::make_unique<EventType>();
 
-        return static_cast<EventType*>(m_events[typeHash].get())->subscribe(action);
+        return static_cast<EventType*>(m_events[typeId].get())->subscribe(action);
     }
 
     template <typename EventType>
@@ -25,12 +29,8 @@ namespace PantheonCore::Eventing
     {
         static_assert(std::is_base_of_v<IEvent, EventType>);
 
-        const size_t typeHash = typeid(EventType).hash_code();
-
-        if (!m_events.contains(typeHash))
-            return;
-
-        m_events[typeHash]->unsubscribe(listener);
+        if (EventType* event = find<EventType>())
+            event->unsubscribe(listener);
     }
 
     template <typename EventType, typename... Args>
@@ -38,19 +38,25 @@ namespace PantheonCore::Eventing
     {
         static_assert(std::is_base_of_v<IEvent, EventType>);
 
-        const size_t typeHash = typeid(EventType).hash_code();
-
-        if (!m_events.contains(typeHash))
-            return;
-
-        static_cast<EventType*>(m_events[typeHash].get())->invoke(args...);
+        if (const EventType* event = find<EventType>())
+            event->invoke(args...);
     }
 
     inline void EventManager::clear()
     {
-        for (const auto& event : m_events | std::views::values)
-            event->clear();
+        for (const EventPtr& event : m_events)
+        {
+            if (event)
+                event->clear();
+        }
 
         m_events.clear();
     }
+
+    template <typename EventType>
+    EventType* EventManager::find() const
+    {
+        const Utility::TypeId typeId = Utility::TypeIdGenerator<IEvent>::get<EventType>();
+        return typeId < m_events.size() ? static_cast<EventType*>(m_events[typeId].get()) : nullptr;
+    }
 }
@@ -0,0 +1,62 @@
+#pragma once
+#include "PantheonCore/Utility/ThreadPool.h"
+
+#include <functional>
+
+namespace PantheonCore::Utility
+{
+    /**
+     * \brief Invokes the given function for each index of the given range on the given thread pool, then waits for completion.\n
+     * The range is recursively split in halves until they are at most grainSize long, and the halves are submitted to the
+     * pool so that idle workers steal the largest pieces first. The calling thread processes a piece as well,
+     * then executes queued tasks until the whole range is done - it never blocks, even from one of the pool's tasks.\n
+     * The function must not throw: an exception escaping one of the pool's tasks terminates the process
+     * \tparam Index The range's index type (an integer or a random access iterator)
+     * \tparam Func The function's type. Either invocable with (Index) for each index or with (Index first, Index last) for each piece
+     * \param threadPool The pool on which the range should be processed
+     * \param begin The range's first index
+     * \param end The index past the range's last index
+     * \param grainSize The maximum number of indices processed by a single task
+     * \param func The function to invoke
+     */
+    template <typename Index, typename Func>
+    void parallelFor(ThreadPool& threadPool, Index begin, Index end, size_t grainSize, Func&& func);
+
+    /**
+     * \brief Reduces the given range to a single value on the given thread pool (see parallelFor).
+     * The range is cut in pieces of grainSize indices, each reduced from the identity value, and the pieces' results are
+     * combined in order on the calling thread - the result is deterministic as long as the reduce function is associative.\n
+     * Neither function may throw (see parallelFor)
+     * \tparam Index The range's index type (an integer or a random access iterator)
+     * \tparam T The result's type
+     * \tparam Func The mapping function's type. Either invocable with (Index) to map an index to a value
+     * or with (Index first, Index last) to reduce a whole piece
+     * \tparam Reduce The reduce function's type. Invocable with (T, T)
+     * \param threadPool The pool on which the range should be processed
+     * \param begin The range's first index
+     * \param end The index past the range's last index
+     * \param grainSize The number of indices reduced by a single task
+     * \param identity The reduction's identity value (e.g. 0 for a sum)
+     * \param func The mapping function
+     * \param reduce The function combining two values
+     * \return The range's reduced value
+     */
+    template <typename Index, typename T, typename Func, typename Reduce = std::plus<>>
+    T parallelReduce(ThreadPool& threadPool, Index begin, Index end, size_t grainSize, T identity, Func&& func, Reduce&& reduce = {});
+
+    /**
+     * \brief Sorts the given range on the given thread pool. Pieces of grainSize elements are sorted in parallel,
+     * then merged pairwise in parallel passes. The sort isn't stable. The comparison function must not throw (see parallelFor)
+     * \tparam RandomIt The range's iterator type
+     * \tparam Compare The comparison function's type
+     * \param threadPool The pool on which the range should be sorted
+     * \param first An iterator to the range's first element
+     * \param last An iterator past the range's last element
+     * \param comp The comparison function
+     * \param grainSize The number of elements sorted by a single task
+     */
+    template <typename RandomIt, typename Compare = std::less<>>
+    void parallelSort(ThreadPool& threadPool, RandomIt first, RandomIt last, Compare comp = {}, size_t grainSize = 4096);
+}
+
+#include "PantheonCore/Utility/Parallel.inl"
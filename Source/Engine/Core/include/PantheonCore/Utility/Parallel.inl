@@ -0,0 +1,146 @@
+#pragma once
+#include "PantheonCore/Utility/Parallel.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace PantheonCore::Utility
+{
+    template <typename Index, typename Func>
+    void parallelFor(ThreadPool& threadPool, const Index begin, const Index end, const size_t grainSize, Func&& func)
+    {
+        if (!(begin < end))
+            return;
+
+        const auto processPiece = [&func](const Index first, const Index last)
+        {
+            if constexpr (std::is_invocable_v<Func&, Index, Index>)
+            {
+                func(first, last);
+            }
+            else
+            {
+                for (Index i = first; i != last; ++i)
+                    func(i);
+            }
+        };
+
+        const size_t grain = std::max<size_t>(grainSize, 1);
+
+        if (threadPool.getWorkersCount() == 0 || static_cast<size_t>(end - begin) <= grain)
+        {
+            processPiece(begin, end);
+            return;
+        }
+
+        TaskCounter counter;
+
+        // Keep the second half for the current thread and submit the first one - thieves take the oldest (largest) pieces
+        const auto split = [&threadPool, &counter, &processPiece, grain](const auto& self, Index first, const Index last) -> void
+        {
+            while (static_cast<size_t>(last - first) > grain)
+            {
+                const Index middle = first + (last - first) / 2;
+
+                threadPool.submit([&self, first, middle]
+                {
+                    self(self, first, middle);
+                }, counter);
+
+                first = middle;
+            }
+
+            processPiece(first, last);
+        };
+
+        split(split, begin, end);
+        threadPool.wait(counter);
+    }
+
+    template <typename Index, typename T, typename Func, typename Reduce>
+    T parallelReduce(ThreadPool& threadPool, const Index begin, const Index end, const size_t grainSize, T identity, Func&& func,
+        Reduce&& reduce)
+    {
+        if (!(begin < end))
+            return identity;
+
+        const size_t grain      = std::max<size_t>(grainSize, 1);
+        const size_t count      = static_cast<size_t>(end - begin);
+        const size_t pieceCount = (count + grain - 1) / grain;
+
+        // One cache line per piece - adjacent results (e.g. vector<bool> bits) would otherwise be shared between tasks
+        struct alignas(std::max<size_t>(64, alignof(T))) Slot
+        {
+            T m_value;
+        };
+
+        std::vector<Slot> results(pieceCount, Slot{ identity });
+
+        parallelFor(threadPool, static_cast<size_t>(0), pieceCount, 1, [&](const size_t piece)
+        {
+            const Index first = begin + static_cast<std::ptrdiff_t>(piece * grain);
+            const Index last  = piece + 1 == pieceCount ? end : first + static_cast<std::ptrdiff_t>(grain);
+
+            if constexpr (std::is_invocable_v<Func&, Index, Index>)
+            {
+                results[piece].m_value = func(first, last);
+            }
+            else
+            {
+                T result = identity;
+
+                for (Index i = first; i != last; ++i)
+                    result = reduce(std::move(result), func(i));
+
+                results[piece].m_value = std::move(result);
+            }
+        });
+
+        T result = std::move(identity);
+
+        for (Slot& slot : results)
+            result = reduce(std::move(result), std::move(slot.m_value));
+
+        return result;
+    }
+
+    template <typename RandomIt, typename Compare>
+    void parallelSort(ThreadPool& threadPool, const RandomIt first, const RandomIt last, Compare comp, const size_t grainSize)
+    {
+        const size_t count = static_cast<size_t>(last - first);
+        const size_t grain = std::max<size_t>(grainSize, 2);
+
+        if (threadPool.getWorkersCount() == 0 || count <= grain)
+        {
+            std::sort(first, last, comp);
+            return;
+        }
+
+        const size_t pieceCount = (count + grain - 1) / grain;
+
+        const auto getBound = [first, last, count, grain](const size_t piece)
+        {
+            return piece * grain < count ? first + static_cast<std::ptrdiff_t>(piece * grain) : last;
+        };
+
+        parallelFor(threadPool, static_cast<size_t>(0), pieceCount, 1, [&](const size_t piece)
+        {
+            std::sort(getBound(piece), getBound(piece + 1), comp);
+        });
+
+        // Merge adjacent sorted runs, doubling their width at each pass
+        for (size_t width = 1; width < pieceCount; width *= 2)
+        {
+            const size_t mergeCount = (pieceCount + 2 * width - 1) / (2 * width);
+
+            parallelFor(threadPool, static_cast<size_t>(0), mergeCount, 1, [&](const size_t merge)
+            {
+                const size_t firstPiece = merge * 2 * width;
+                const RandomIt middle   = getBound(firstPiece + width);
+
+                if (middle != last)
+                    std::inplace_merge(getBound(firstPiece), middle, getBound(firstPiece + 2 * width), comp);
+            });
+        }
+    }
+}
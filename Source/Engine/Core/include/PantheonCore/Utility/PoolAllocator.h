@@ -0,0 +1,107 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace PantheonCore::Utility
+{
+    /**
+     * \brief Fixed-size block allocator with per-thread caches. Each thread allocates from and frees to its own cache
+     * without synchronization. Caches exchange batches of blocks with a shared free list when they run empty or grow
+     * too large, and new pages are only allocated when the shared list is empty as well.\n
+     * Blocks can be freed to a different cache than the one they were allocated from.
+     * Pages are only released when the allocator is destroyed
+     */
+    class PoolAllocator
+    {
+        struct Block
+        {
+            Block* m_next;
+        };
+
+    public:
+        /**
+         * \brief A thread's free blocks. Must only be used by one thread at a time
+         */
+        class Cache
+        {
+            friend class PoolAllocator;
+
+            Block* m_freeList  = nullptr;
+            size_t m_freeCount = 0;
+        };
+
+        /**
+         * \brief Creates an allocator for blocks of the given size
+         * \param blockSize The size of the allocated blocks
+         * \param blocksPerPage The number of blocks allocated at once. Also the size of the batches exchanged by the caches
+         */
+        explicit PoolAllocator(size_t blockSize, size_t blocksPerPage = 256);
+
+        /**
+         * \brief Disable pool allocator copy
+         */
+        PoolAllocator(const PoolAllocator&) = delete;
+
+        /**
+         * \brief Disable pool allocator move
+         */
+        PoolAllocator(PoolAllocator&&) = delete;
+
+        /**
+         * \brief Destroys the allocator and releases its pages. Every block must have been freed
+         */
+        ~PoolAllocator() = default;
+
+        /**
+         * \brief Disable pool allocator copy
+         */
+        PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+        /**
+         * \brief Disable pool allocator move
+         */
+        PoolAllocator& operator=(PoolAllocator&&) = delete;
+
+        /**
+         * \brief Allocates a block from the given cache, refilling it if necessary
+         * \param cache The calling thread's cache
+         * \return A pointer to the allocated block, aligned for any fundamental type
+         */
+        void* allocate(Cache& cache);
+
+        /**
+         * \brief Frees the given block to the given cache, moving a batch of blocks to the shared list if the cache is too large
+         * \param cache The calling thread's cache
+         * \param block The freed block
+         */
+        void deallocate(Cache& cache, void* block);
+
+        /**
+         * \brief Moves all of the given cache's blocks to the shared list (e.g. before the cache's thread exits)
+         * \param cache The released cache
+         */
+        void release(Cache& cache);
+
+        /**
+         * \brief Gets the size of the allocated blocks
+         * \return The allocator's block size
+         */
+        size_t getBlockSize() const;
+
+    private:
+        std::mutex                                m_mutex;
+        std::vector<std::unique_ptr<std::byte[]>> m_pages;
+        Block*                                    m_sharedList;
+        size_t                                    m_sharedCount;
+        size_t                                    m_blockSize;
+        size_t                                    m_blocksPerPage;
+
+        /**
+         * \brief Moves a batch of blocks from the shared list to the given empty cache, allocating a page if necessary
+         * \param cache The refilled cache
+         */
+        void refill(Cache& cache);
+    };
+}
@@ -1,7 +1,8 @@
 #pragma once
-#include <unordered_map>
+#include <vector>
 
 #include "PantheonCore/Debug/Assertion.h"
+#include "PantheonCore/Utility/TypeId.h"
 
 #define PTH_SERVICE(Type) PantheonCore::Utility::ServiceLocator::get<Type>()
 
@@ -18,7 +19,12 @@ namespace PantheonCore::Utility
         template <typename T>
         static void provide(T& service)
         {
-            s_services[typeid(T).hash_code()] = &service;
+            const TypeId typeId = TypeIdGenerator<ServiceLocator>::get<T>();
+
+            if (typeId >= s_services.size())
+                s_services.resize(typeId + 1, nullptr);
+
+            s_services[typeId] = &service;
         }
 
         /**
@@ -29,11 +35,13 @@ namespace PantheonCore::Utility
         template <typename T>
         static T& get()
         {
-            ASSERT(s_services.contains(typeid(T).hash_code()));
-            return *static_cast<T*>(s_services[typeid(T).hash_code()]);
+            const TypeId typeId = TypeIdGenerator<ServiceLocator>::get<T>();
+
+            ASSERT(typeId < s_services.size() && s_services[typeId] != nullptr);
+            return *static_cast<T*>(s_services[typeId]);
         }
 
     private:
-        inline static std::unordered_map<size_t, void*> s_services;
+        inline static std::vector<void*> s_services;
     };
 }
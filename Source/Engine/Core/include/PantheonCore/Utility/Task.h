@@ -0,0 +1,97 @@
+#pragma once
+#include <cstddef>
+#include <type_traits>
+
+namespace PantheonCore::Utility
+{
+    /**
+     * \brief Move-only type-erased void() callable. Callables of up to INLINE_SIZE bytes are stored inline,
+     * larger ones are allocated on the heap
+     */
+    class Task
+    {
+    public:
+        static constexpr size_t INLINE_SIZE = 48;
+
+        /**
+         * \brief Checks whether the given callable type is stored in the task's inline buffer
+         * \tparam Func The callable's type
+         */
+        template <typename Func>
+        static constexpr bool IsInline = sizeof(Func) <= INLINE_SIZE && alignof(Func) <= alignof(std::max_align_t)
+            && std::is_nothrow_move_constructible_v<Func>;
+
+        /**
+         * \brief Creates an empty task
+         */
+        Task() = default;
+
+        /**
+         * \brief Creates a task executing the given callable
+         * \tparam Func The callable's type
+         * \param func The callable to execute
+         */
+        template <typename Func, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Func>, Task>>>
+        Task(Func&& func);
+
+        /**
+         * \brief Disable task copy
+         */
+        Task(const Task&) = delete;
+
+        /**
+         * \brief Creates a move copy of the given task
+         * \param other The task to move
+         */
+        Task(Task&& other) noexcept;
+
+        /**
+         * \brief Destroys the task and its callable
+         */
+        ~Task();
+
+        /**
+         * \brief Disable task copy
+         */
+        Task& operator=(const Task&) = delete;
+
+        /**
+         * \brief Moves the given task into this one
+         * \param other The task to move
+         * \return A reference to the modified task
+         */
+        Task& operator=(Task&& other) noexcept;
+
+        /**
+         * \brief Executes the task's callable. The task must not be empty
+         */
+        void operator()();
+
+        /**
+         * \brief Checks whether the task holds a callable or not
+         * \return True if the task holds a callable. False otherwise
+         */
+        explicit operator bool() const;
+
+    private:
+        struct Operations
+        {
+            void (*invoke)(void* storage);
+            void (*move)(void* target, void* source);
+            void (*destroy)(void* storage);
+        };
+
+        alignas(std::max_align_t) std::byte m_storage[INLINE_SIZE];
+        const Operations*                   m_operations = nullptr;
+
+        /**
+         * \brief Gets the operations table for the given callable type
+         * \tparam Func The stored callable's type
+         * \return A reference to the callable type's operations table
+         */
+        template <typename Func>
+        static const Operations& getOperations();
+    };
+}
+
+#include "PantheonCore/Utility/Task.inl"
@@ -0,0 +1,114 @@
+#pragma once
+#include "PantheonCore/Utility/Task.h"
+
+#include "PantheonCore/Debug/Assertion.h"
+
+#include <new>
+#include <utility>
+
+namespace PantheonCore::Utility
+{
+    template <typename Func, typename>
+    Task::Task(Func&& func)
+        : m_operations(&getOperations<std::decay_t<Func>>())
+    {
+        using FuncT = std::decay_t<Func>;
+
+        if constexpr (IsInline<FuncT>)
+            new(m_storage) FuncT(std::forward<Func>(func));
+        else
+            new(m_storage) FuncT*(new FuncT(std::forward<Func>(func)));
+    }
+
+    inline Task::Task(Task&& other) noexcept
+        : m_operations(other.m_operations)
+    {
+        if (m_operations)
+            m_operations->move(m_storage, other.m_storage);
+
+        other.m_operations = nullptr;
+    }
+
+    inline Task::~Task()
+    {
+        if (m_operations)
+            m_operations->destroy(m_storage);
+    }
+
+    inline Task& Task::operator=(Task&& other) noexcept
+    {
+        if (&other == this)
+            return *this;
+
+        if (m_operations)
+            m_operations->destroy(m_storage);
+
+        m_operations = other.m_operations;
+
+        if (m_operations)
+            m_operations->move(m_storage, other.m_storage);
+
+        other.m_operations = nullptr;
+        return *this;
+    }
+
+    inline void Task::operator()()
+    {
+        ASSERT(m_operations != nullptr, "Unable to execute task - The task is empty");
+        m_operations->invoke(m_storage);
+    }
+
+    inline Task::operator bool() const
+    {
+        return m_operations != nullptr;
+    }
+
+    template <typename Func>
+    const Task::Operations& Task::getOperations()
+    {
+        if constexpr (IsInline<Func>)
+        {
+            static constexpr Operations operations
+            {
+                [](void* storage)
+                {
+                    (*std::launder(static_cast<Func*>(storage)))();
+                },
+                [](void* target, void* source)
+                {
+                    Func& func = *std::launder(static_cast<Func*>(source));
+
+                    new(target) Func(std::move(func));
+                    func.~Func();
+                },
+                [](void* storage)
+                {
+                    std::launder(static_cast<Func*>(storage))->~Func();
+                }
+            };
+
+            return operations;
+        }
+        else
+        {
+            // The buffer only holds a pointer to the heap allocated callable
+            static constexpr Operations operations
+            {
+                [](void* storage)
+                {
+                    (**static_cast<Func**>(storage))();
+                },
+                [](void* target, void* source)
+                {
+                    new(target) Func*(*static_cast<Func**>(source));
+                },
+                [](void* storage)
+                {
+                    delete *static_cast<Func**>(storage);
+                }
+            };
+
+            return operations;
+        }
+    }
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include <atomic>
+
+namespace PantheonCore::Utility
+{
+    /**
+     * \brief Counts the unfinished tasks of a batch (e.g. the tasks submitted to a thread pool with the counter).
+     * The batch is complete once the counter reaches zero. Lighter than a future per task
+     */
+    class TaskCounter
+    {
+    public:
+        /**
+         * \brief Creates a counter without pending tasks
+         */
+        TaskCounter() = default;
+
+        /**
+         * \brief Disable task counter copy
+         */
+        TaskCounter(const TaskCounter&) = delete;
+
+        /**
+         * \brief Disable task counter move
+         */
+        TaskCounter(TaskCounter&&) = delete;
+
+        /**
+         * \brief Destroys the task counter
+         */
+        ~TaskCounter() = default;
+
+        /**
+         * \brief Disable task counter copy
+         */
+        TaskCounter& operator=(const TaskCounter&) = delete;
+
+        /**
+         * \brief Disable task counter move
+         */
+        TaskCounter& operator=(TaskCounter&&) = delete;
+
+        /**
+         * \brief Adds the given number of pending tasks to the counter
+         * \param count The number of added tasks
+         */
+        void increment(size_t count = 1);
+
+        /**
+         * \brief Marks one of the counter's tasks as complete
+         * \return True if it was the last pending task. False otherwise
+         */
+        bool decrement();
+
+        /**
+         * \brief Checks whether all of the counter's tasks are complete or not
+         * \return True if no task is pending. False otherwise
+         */
+        bool isDone() const;
+
+        /**
+         * \brief Gets the counter's number of pending tasks
+         * \return The number of pending tasks
+         */
+        size_t getCount() const;
+
+    private:
+        std::atomic<size_t> m_count = 0;
+    };
+}
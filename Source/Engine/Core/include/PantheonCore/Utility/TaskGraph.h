@@ -0,0 +1,168 @@
+#pragma once
+#include "PantheonCore/Utility/Task.h"
+#include "PantheonCore/Utility/TaskCounter.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace PantheonCore::Utility
+{
+    class ThreadPool;
+
+    /**
+     * \brief Directed acyclic graph of jobs executed on a thread pool's workers (e.g. a frame's decode -> mip chain -> upload
+     * chain running next to physics and animation).\n
+     * Each node counts its unfinished predecessors with an atomic counter. The thread finishing the last predecessor of a
+     * node schedules it right away - no thread polls the graph. One of the ready successors is executed as a continuation by
+     * that same thread, the other ones are submitted to the pool.\n
+     * The graph's nodes, edges and tasks are only allocated when they are added, so the same graph can be run every frame
+     * without allocating. The duration of each node's last execution is recorded for profiling (see dumpTimings)
+     */
+    class TaskGraph
+    {
+    public:
+        using NodeId = size_t;
+
+        struct NodeTiming
+        {
+            double m_start;
+            double m_duration;
+        };
+
+        /**
+         * \brief Creates an empty task graph
+         */
+        TaskGraph() = default;
+
+        /**
+         * \brief Disable task graph copy
+         */
+        TaskGraph(const TaskGraph&) = delete;
+
+        /**
+         * \brief Disable task graph move
+         */
+        TaskGraph(TaskGraph&&) = delete;
+
+        /**
+         * \brief Destroys the task graph and its nodes. The graph must not be running
+         */
+        ~TaskGraph() = default;
+
+        /**
+         * \brief Disable task graph copy
+         */
+        TaskGraph& operator=(const TaskGraph&) = delete;
+
+        /**
+         * \brief Disable task graph move
+         */
+        TaskGraph& operator=(TaskGraph&&) = delete;
+
+        /**
+         * \brief Adds a node executing the given function to the graph. The function must not throw
+         * \tparam Func The function's type
+         * \param name The node's name, used in the timings dump
+         * \param func The function to execute on each run
+         * \return The added node's id
+         */
+        template <typename Func>
+        NodeId addNode(const std::string& name, Func&& func);
+
+        /**
+         * \brief Makes the given node wait for the given predecessor's completion on each run.
+         * The graph must stay acyclic and must not be running
+         * \param node The dependent node's id
+         * \param predecessor The id of the node to wait for
+         */
+        void addDependency(NodeId node, NodeId predecessor);
+
+        /**
+         * \brief Executes all of the graph's nodes on the given thread pool and waits for their completion.
+         * The calling thread executes the pool's queued tasks while waiting, so the graph can be run from one of the pool's tasks
+         * \param threadPool The pool on which the graph's nodes should be executed
+         */
+        void run(ThreadPool& threadPool);
+
+        /**
+         * \brief Removes all of the graph's nodes. The graph must not be running
+         */
+        void clear();
+
+        /**
+         * \brief Gets the graph's number of nodes
+         * \return The graph's number of nodes
+         */
+        size_t getNodeCount() const;
+
+        /**
+         * \brief Gets the name of the given node
+         * \param node The node's id
+         * \return The node's name
+         */
+        const std::string& getName(NodeId node) const;
+
+        /**
+         * \brief Gets the timing of the given node's last execution
+         * \param node The node's id
+         * \return The node's start time relative to the start of the last run and its duration, in milliseconds
+         */
+        NodeTiming getTiming(NodeId node) const;
+
+        /**
+         * \brief Gets the duration of the graph's last run
+         * \return The last run's duration in milliseconds
+         */
+        double getDuration() const;
+
+        /**
+         * \brief Formats the timings of the graph's last run, one line per node
+         * \return A string containing each node's name, start time and duration
+         */
+        std::string dumpTimings() const;
+
+    private:
+        using Clock = std::chrono::high_resolution_clock;
+
+        struct Node
+        {
+            std::string         m_name;
+            Task                m_task;
+            std::vector<Node*>  m_successors;
+            size_t              m_predecessorsCount = 0;
+            std::atomic<size_t> m_pendingCount      = 0;
+            NodeTiming          m_timing {};
+        };
+
+        std::vector<std::unique_ptr<Node>> m_nodes;
+        TaskCounter                         m_counter;
+        Clock::time_point                   m_startTime;
+        double                              m_duration = 0;
+
+        /**
+         * \brief Submits a task executing the given ready node to the given thread pool
+         * \param threadPool The pool on which the node should be executed
+         * \param node The node to execute
+         */
+        void schedule(ThreadPool& threadPool, Node& node);
+
+        /**
+         * \brief Executes the given node, then schedules its ready successors. The first ready successor is executed
+         * right away on the calling thread
+         * \param threadPool The pool on which the graph's nodes are executed
+         * \param node The node to execute
+         */
+        void execute(ThreadPool& threadPool, Node* node);
+
+        /**
+         * \brief Gets the time elapsed since the start of the current run
+         * \return The elapsed time in milliseconds
+         */
+        double getElapsedTime() const;
+    };
+}
+
+#include "PantheonCore/Utility/TaskGraph.inl"
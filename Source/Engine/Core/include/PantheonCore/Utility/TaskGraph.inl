@@ -0,0 +1,19 @@
+#pragma once
+#include "PantheonCore/Utility/TaskGraph.h"
+
+#include "PantheonCore/Debug/Assertion.h"
+
+namespace PantheonCore::Utility
+{
+    template <typename Func>
+    TaskGraph::NodeId TaskGraph::addNode(const std::string& name, Func&& func)
+    {
+        ASSERT(m_counter.isDone(), "Unable to add task graph node - The graph is running");
+
+        std::unique_ptr<Node>& node = m_nodes.emplace_back(std::make_unique<Node>());
+        node->m_name                = name;
+        node->m_task                = Task(std::forward<Func>(func));
+
+        return m_nodes.size() - 1;
+    }
+}
@@ -1,18 +1,30 @@
 ﻿#pragma once
-#include <functional>
+#include "PantheonCore/Utility/PoolAllocator.h"
+#include "PantheonCore/Utility/Task.h"
+#include "PantheonCore/Utility/TaskCounter.h"
+#include "PantheonCore/Utility/WorkStealingDeque.h"
+
+#include <condition_variable>
+#include <deque>
 #include <future>
 #include <mutex>
-#include <queue>
 #include <thread>
 #include <type_traits>
 
 namespace PantheonCore::Utility
 {
+    /**
+     * \brief Work-stealing thread pool. Each worker owns a Chase-Lev deque: tasks submitted from a worker are pushed to its
+     * own deque and popped in LIFO order, while idle workers steal the oldest tasks of a random victim.
+     * Tasks submitted from other threads go through a shared queue, from which workers take the oldest tasks while waiting
+     * external threads take the newest ones - like a worker's own deque, to keep nested waits depth-first.\n
+     * Idle workers spin for a short while before going to sleep, and are only woken up when tasks are submitted.\n
+     * Tasks are stored inline (see Task) in blocks drawn from per-worker caches of a pool allocator,
+     * so fire-and-forget submissions don't allocate once the pool is warm
+     */
     class ThreadPool
     {
     public:
-        using Action = std::function<void()>;
-
         ThreadPool();
         explicit ThreadPool(unsigned workersCount);
         ThreadPool(const ThreadPool&) = delete;
@@ -28,6 +40,57 @@ namespace PantheonCore::Utility
         template <typename Func, typename... Args>
         std::future<std::invoke_result_t<Func, Args...>> enqueue(Func&& func, Args&&... args);
 
+        /**
+         * \brief Queues the given function without tracking its completion. The function must not throw
+         * \tparam Func The function's type
+         * \param func The function to execute
+         */
+        template <typename Func>
+        void submit(Func&& func);
+
+        /**
+         * \brief Queues the given function and tracks its completion with the given counter.
+         * The counter is incremented right away and decremented once the function has returned. The function must not throw
+         * \tparam Func The function's type
+         * \param func The function to execute
+         * \param counter The counter tracking the function's completion. Must outlive the task
+         */
+        template <typename Func>
+        void submit(Func&& func, TaskCounter& counter);
+
+        /**
+         * \brief Executes one of the pool's queued tasks on the calling thread, if any. Lets a thread waiting on the pool's
+         * tasks (e.g. the parent of a fork-join) help instead of blocking
+         * \return True if a task was executed. False if no task could be found
+         */
+        bool runPendingTask();
+
+        /**
+         * \brief Executes the pool's queued tasks on the calling thread until the given counter's tasks are complete.
+         * Safe to call from one of the pool's tasks, unlike blocking on a future
+         * \param counter The counter to wait for
+         */
+        void wait(const TaskCounter& counter);
+
+        /**
+         * \brief Executes the pool's queued tasks on the calling thread until the given future is ready.
+         * Safe to call from one of the pool's tasks, unlike future::get
+         * \tparam T The future's value type
+         * \param future The future to wait for
+         */
+        template <typename T>
+        void wait(const std::future<T>& future);
+
+        /**
+         * \brief Executes the pool's queued tasks on the calling thread until all of the pool's tasks are complete.
+         * Must not be called from one of the pool's tasks since the calling task would never complete
+         */
+        void waitIdle();
+
+        /**
+         * \brief Checks whether the pool has unfinished tasks or not. Lock-free
+         * \return True if a task is queued or running. False otherwise
+         */
         bool isBusy() const;
         void stop();
 
@@ -35,16 +98,105 @@ namespace PantheonCore::Utility
         unsigned getActiveCount() const;
 
     private:
-        mutable std::mutex       m_tasksMutex;
-        std::condition_variable  m_mutexCondition;
-        std::queue<Action>       m_tasks;
-        std::vector<std::thread> m_threads;
-        unsigned                 m_workersCount;
-        unsigned                 m_activeWorkersCount;
-        bool                     m_isRunning;
-        bool                     m_shouldTerminate;
-
-        void workerLoop();
+        struct QueuedTask
+        {
+            Task         m_task;
+            TaskCounter* m_counter;
+        };
+
+        struct Worker
+        {
+            WorkStealingDeque<QueuedTask*> m_tasks;
+            PoolAllocator::Cache           m_taskCache;
+            std::thread                    m_thread;
+            ThreadPool*                    m_pool;
+            uint32_t                       m_seed;
+        };
+
+        // Idle threads keep looking for tasks for a while before going to sleep - waking a thread up costs a lot more
+        static constexpr int IDLE_SPIN_COUNT = 64;
+
+        static thread_local Worker* s_localWorker;
+
+        std::vector<std::unique_ptr<Worker>> m_workers;
+        PoolAllocator                        m_taskAllocator;
+        PoolAllocator::Cache                 m_externalCache;
+        std::mutex                           m_queueMutex;
+        std::deque<QueuedTask*>              m_queue;
+        std::atomic<size_t>                  m_queueSize;
+        mutable std::mutex                   m_sleepMutex;
+        std::condition_variable              m_sleepCondition;
+        std::condition_variable              m_waitCondition;
+        std::atomic<size_t>                  m_pendingCount;
+        std::atomic<size_t>                  m_unfinishedCount;
+        std::atomic<unsigned>                m_activeWorkersCount;
+        std::atomic<unsigned>                m_sleepingCount;
+        std::atomic<unsigned>                m_waitingCount;
+        unsigned                             m_workersCount;
+        bool                                 m_isRunning;
+        std::atomic<bool>                    m_shouldTerminate;
+
+        /**
+         * \brief Creates a task executing the given function and queues it
+         * \tparam Func The function's type
+         * \param func The function to execute
+         * \param counter The counter tracking the task's completion, if any
+         */
+        template <typename Func>
+        void schedule(Func&& func, TaskCounter* counter);
+
+        /**
+         * \brief Executes the pool's queued tasks on the calling thread until the given condition is met.
+         * When no task can be found for a while, the thread sleeps until a task completes or gets queued
+         * \tparam Predicate The condition's type
+         * \param isDone The condition to wait for
+         */
+        template <typename Predicate>
+        void helpUntil(Predicate&& isDone);
+
+        /**
+         * \brief Allocates a task block from the calling worker's cache, or from the shared cache for other threads
+         * \param worker The calling thread's worker. Nullptr for threads outside the pool
+         * \return A pointer to the allocated block
+         */
+        void* allocateTask(Worker* worker);
+
+        /**
+         * \brief Queues the given task in the calling worker's deque, or in the shared queue for other threads,
+         * and wakes a sleeping worker up if any
+         * \param task The task to queue
+         * \param worker The calling thread's worker. Nullptr for threads outside the pool
+         */
+        void push(QueuedTask* task, Worker* worker);
+
+        /**
+         * \brief Takes a task from the given worker's deque, the shared queue or another worker's deque, in that order
+         * \param worker The calling thread's worker. Nullptr for threads outside the pool
+         * \return A pointer to the found task on success. Nullptr otherwise
+         */
+        QueuedTask* findTask(Worker* worker);
+
+        /**
+         * \brief Executes and destroys the given task, then notifies its counter
+         * \param task The task to execute
+         * \param worker The calling thread's worker. Nullptr for threads outside the pool
+         */
+        void execute(QueuedTask* task, Worker* worker);
+
+        /**
+         * \brief Destroys the given task and returns its block to the calling thread's cache
+         * \param task The task to destroy
+         * \param worker The calling thread's worker. Nullptr for threads outside the pool
+         */
+        void destroyTask(QueuedTask* task, Worker* worker);
+
+        /**
+         * \brief Gets the calling thread's worker if it belongs to this pool
+         * \return A pointer to the calling thread's worker on success. Nullptr otherwise
+         */
+        Worker* getLocalWorker() const;
+
+        void workerLoop(Worker& worker);
     };
 }
 
@@ -1,23 +1,86 @@
 ﻿#pragma once
 #include "ThreadPool.h"
 
+#include <functional>
+
 namespace PantheonCore::Utility
 {
     template <typename Func, typename... Args>
     std::future<std::invoke_result_t<Func, Args...>> ThreadPool::enqueue(Func&& func, Args&&... args)
     {
-        using PackagedTask = std::packaged_task<std::invoke_result_t<Func, Args...>()>;
-        auto package = std::make_shared<PackagedTask>(std::bind(std::forward<Func>(func), std::forward<Args>(args)...));
+        // The packaged task is move-only and small enough to be stored inline - only the future's shared state is allocated
+        std::packaged_task<std::invoke_result_t<Func, Args...>()> package(std::bind(std::forward<Func>(func), std::forward<Args>(args)...));
+        std::future<std::invoke_result_t<Func, Args...>>          future = package.get_future();
+
+        schedule([package = std::move(package)]() mutable
+        {
+            package();
+        }, nullptr);
+
+        return future;
+    }
+
+    template <typename Func>
+    void ThreadPool::submit(Func&& func)
+    {
+        schedule(std::forward<Func>(func), nullptr);
+    }
+
+    template <typename Func>
+    void ThreadPool::submit(Func&& func, TaskCounter& counter)
+    {
+        counter.increment();
+        schedule(std::forward<Func>(func), &counter);
+    }
 
+    template <typename T>
+    void ThreadPool::wait(const std::future<T>& future)
+    {
+        helpUntil([&future]
         {
-            std::lock_guard lock(m_tasksMutex);
-            m_tasks.emplace([package]
+            return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        });
+    }
+
+    template <typename Func>
+    void ThreadPool::schedule(Func&& func, TaskCounter* counter)
+    {
+        Worker* worker = getLocalWorker();
+        push(new(allocateTask(worker)) QueuedTask{ Task(std::forward<Func>(func)), counter }, worker);
+    }
+
+    template <typename Predicate>
+    void ThreadPool::helpUntil(Predicate&& isDone)
+    {
+        int idleCount = 0;
+
+        while (!isDone())
+        {
+            if (runPendingTask())
             {
-                (*package)();
+                idleCount = 0;
+                continue;
+            }
+
+            // Nothing left to steal - the awaited tasks are running on other threads
+            if (++idleCount < IDLE_SPIN_COUNT)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            // Same protocol as the sleeping workers - completed tasks check the waiting count after their side effects
+            std::unique_lock lock(m_sleepMutex);
+            ++m_waitingCount;
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            m_waitCondition.wait(lock, [this, &isDone]
+            {
+                return isDone() || m_pendingCount.load() > 0;
             });
-        }
 
-        m_mutexCondition.notify_one();
-        return package->get_future();
+            --m_waitingCount;
+            idleCount = 0;
+        }
     }
 }
@@ -0,0 +1,48 @@
+#pragma once
+#include <atomic>
+#include <type_traits>
+
+namespace PantheonCore::Utility
+{
+    using TypeId = size_t;
+
+    /**
+     * \brief Generates dense sequential ids for the types used with a given family.
+     * Each family has its own sequence starting at 0, which makes the ids usable as indices in flat arrays
+     * \tparam Family The ids' family (e.g. the base class of the indexed objects)
+     */
+    template <typename Family>
+    class TypeIdGenerator
+    {
+    public:
+        TypeIdGenerator() = delete;
+
+        /**
+         * \brief Gets the id of the given type in the generator's family, generating it on first use.
+         * cv-qualifiers and references are ignored
+         * \tparam T The target type
+         * \return The given type's id
+         */
+        template <typename T>
+        static TypeId get();
+
+        /**
+         * \brief Gets the number of ids generated in the generator's family so far
+         * \return The number of generated ids
+         */
+        static TypeId getCount();
+
+    private:
+        inline static std::atomic<TypeId> s_nextId = 0;
+
+        /**
+         * \brief Gets the id of the given unqualified type in the generator's family, generating it on first use
+         * \tparam T The target type
+         * \return The given type's id
+         */
+        template <typename T>
+        static TypeId generate();
+    };
+}
+
+#include "PantheonCore/Utility/TypeId.inl"
@@ -0,0 +1,27 @@
+#pragma once
+#include "PantheonCore/Utility/TypeId.h"
+
+namespace PantheonCore::Utility
+{
+    template <typename Family>
+    template <typename T>
+    TypeId TypeIdGenerator<Family>::get()
+    {
+        return generate<std::remove_cvref_t<T>>();
+    }
+
+    template <typename Family>
+    TypeId TypeIdGenerator<Family>::getCount()
+    {
+        return s_nextId.load(std::memory_order_relaxed);
+    }
+
+    template <typename Family>
+    template <typename T>
+    TypeId TypeIdGenerator<Family>::generate()
+    {
+        // Function-local statics are initialized on first use, which keeps ids valid during static initialization
+        static const TypeId id = s_nextId.fetch_add(1, std::memory_order_relaxed);
+        return id;
+    }
+}
@@ -0,0 +1,116 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace PantheonCore::Utility
+{
+    /**
+     * \brief Lock-free Chase-Lev work-stealing deque. The owner thread pushes and pops at the bottom (LIFO) while any
+     * other thread can concurrently steal from the top (FIFO).\n
+     * The ring buffer grows when full. Replaced buffers are kept alive until the deque is destroyed since a concurrent
+     * thief may still be reading from them
+     * \tparam T The stored elements' type. Must be trivially copyable (e.g. a pointer)
+     */
+    template <typename T>
+    class WorkStealingDeque
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+
+    public:
+        /**
+         * \brief Creates an empty deque
+         * \param capacity The deque's initial capacity. Rounded up to a power of two
+         */
+        explicit WorkStealingDeque(size_t capacity = 256);
+
+        /**
+         * \brief Disable work-stealing deque copy
+         */
+        WorkStealingDeque(const WorkStealingDeque&) = delete;
+
+        /**
+         * \brief Disable work-stealing deque move
+         */
+        WorkStealingDeque(WorkStealingDeque&&) = delete;
+
+        /**
+         * \brief Destroys the deque and its buffers
+         */
+        ~WorkStealingDeque() = default;
+
+        /**
+         * \brief Disable work-stealing deque copy
+         */
+        WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+        /**
+         * \brief Disable work-stealing deque move
+         */
+        WorkStealingDeque& operator=(WorkStealingDeque&&) = delete;
+
+        /**
+         * \brief Adds the given element at the bottom of the deque. Must only be called by the owner thread
+         * \param value The element to add
+         */
+        void push(T value);
+
+        /**
+         * \brief Removes the most recently pushed element. Must only be called by the owner thread
+         * \param out The output element
+         * \return True if an element was popped. False if the deque was empty
+         */
+        bool pop(T& out);
+
+        /**
+         * \brief Removes the oldest element of the deque. Can be called concurrently from any thread
+         * \param out The output element
+         * \return True if an element was stolen. False if the deque was empty or another thread won the race
+         */
+        bool steal(T& out);
+
+        /**
+         * \brief Gets an estimate of the deque's number of elements. Exact when called by the owner thread
+         * with no concurrent thief
+         * \return The deque's approximate size
+         */
+        size_t size() const;
+
+        /**
+         * \brief Checks whether the deque seems empty or not. See size()
+         * \return True if the deque seems empty. False otherwise
+         */
+        bool empty() const;
+
+    private:
+        struct Buffer
+        {
+            std::unique_ptr<std::atomic<T>[]> m_data;
+            int64_t                           m_mask;
+
+            explicit Buffer(size_t capacity);
+
+            T    get(int64_t index) const;
+            void put(int64_t index, T value);
+        };
+
+        // Keep the owner's and the thieves' indices on separate cache lines
+        alignas(64) std::atomic<int64_t> m_top;
+        alignas(64) std::atomic<int64_t> m_bottom;
+        alignas(64) std::atomic<Buffer*> m_buffer;
+
+        std::vector<std::unique_ptr<Buffer>> m_buffers;
+
+        /**
+         * \brief Replaces the current buffer with one twice as large, copying the elements in [top, bottom)
+         * \param top The deque's current top index
+         * \param bottom The deque's current bottom index
+         * \return A pointer to the new buffer
+         */
+        Buffer* grow(int64_t top, int64_t bottom);
+    };
+}
+
+#include "PantheonCore/Utility/WorkStealingDeque.inl"
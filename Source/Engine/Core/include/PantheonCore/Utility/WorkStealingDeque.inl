@@ -0,0 +1,128 @@
+#pragma once
+#include "PantheonCore/Utility/WorkStealingDeque.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace PantheonCore::Utility
+{
+    template <typename T>
+    WorkStealingDeque<T>::Buffer::Buffer(const size_t capacity)
+        : m_data(std::make_unique<std::atomic<T>[]>(capacity)), m_mask(static_cast<int64_t>(capacity) - 1)
+    {
+    }
+
+    template <typename T>
+    T WorkStealingDeque<T>::Buffer::get(const int64_t index) const
+    {
+        return m_data[index & m_mask].load(std::memory_order_relaxed);
+    }
+
+    template <typename T>
+    void WorkStealingDeque<T>::Buffer::put(const int64_t index, const T value)
+    {
+        m_data[index & m_mask].store(value, std::memory_order_relaxed);
+    }
+
+    template <typename T>
+    WorkStealingDeque<T>::WorkStealingDeque(const size_t capacity)
+        : m_top(0), m_bottom(0)
+    {
+        m_buffers.push_back(std::make_unique<Buffer>(std::bit_ceil(std::max<size_t>(capacity, 2))));
+        m_buffer.store(m_buffers.back().get(), std::memory_order_relaxed);
+    }
+
+    template <typename T>
+    void WorkStealingDeque<T>::push(const T value)
+    {
+        const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+        const int64_t top    = m_top.load(std::memory_order_acquire);
+        Buffer*       buffer = m_buffer.load(std::memory_order_relaxed);
+
+        if (bottom - top > buffer->m_mask)
+            buffer = grow(top, bottom);
+
+        buffer->put(bottom, value);
+
+        // Publish the element before the new bottom
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+
+    template <typename T>
+    bool WorkStealingDeque<T>::pop(T& out)
+    {
+        const int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        Buffer*       buffer = m_buffer.load(std::memory_order_relaxed);
+
+        // Reserve the bottom element before reading the top - thieves read both in the opposite order
+        m_bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        int64_t top = m_top.load(std::memory_order_relaxed);
+
+        if (top > bottom)
+        {
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        out = buffer->get(bottom);
+
+        if (top != bottom)
+            return true;
+
+        // Last element - race against the thieves for it
+        const bool isWon = m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+
+        return isWon;
+    }
+
+    template <typename T>
+    bool WorkStealingDeque<T>::steal(T& out)
+    {
+        int64_t top = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t bottom = m_bottom.load(std::memory_order_acquire);
+
+        if (top >= bottom)
+            return false;
+
+        // The element must be read before claiming it - the owner may overwrite its slot as soon as the top moves
+        const Buffer* buffer = m_buffer.load(std::memory_order_acquire);
+        out                  = buffer->get(top);
+
+        return m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+
+    template <typename T>
+    size_t WorkStealingDeque<T>::size() const
+    {
+        const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+        const int64_t top    = m_top.load(std::memory_order_relaxed);
+
+        return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+    }
+
+    template <typename T>
+    bool WorkStealingDeque<T>::empty() const
+    {
+        return size() == 0;
+    }
+
+    template <typename T>
+    typename WorkStealingDeque<T>::Buffer* WorkStealingDeque<T>::grow(const int64_t top, const int64_t bottom)
+    {
+        const Buffer* current = m_buffer.load(std::memory_order_relaxed);
+        auto          buffer  = std::make_unique<Buffer>(2 * static_cast<size_t>(current->m_mask + 1));
+
+        for (int64_t i = top; i < bottom; ++i)
+            buffer->put(i, current->get(i));
+
+        Buffer* result = m_buffers.emplace_back(std::move(buffer)).get();
+        m_buffer.store(result, std::memory_order_release);
+
+        return result;
+    }
+}
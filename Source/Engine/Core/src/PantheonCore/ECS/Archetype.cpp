@@ -0,0 +1,236 @@
+#include "PantheonCore/ECS/Archetype.h"
+
+#include "PantheonCore/Debug/Assertion.h"
+
+#include <algorithm>
+
+namespace PantheonCore::ECS
+{
+    Archetype::Archetype(const std::vector<const ColumnType*>& columnTypes)
+        : m_chunkCapacity(1), m_chunkSize(CHUNK_SIZE), m_count(0)
+    {
+        size_t rowSize = sizeof(Entity);
+
+        m_columns.reserve(columnTypes.size());
+        m_types.reserve(columnTypes.size());
+
+        for (const ColumnType* type : columnTypes)
+        {
+            ASSERT(m_types.empty() || m_types.back() < type->m_typeId, "Archetype column types should be sorted and unique");
+
+            if (type->m_typeId >= m_columnLookup.size())
+                m_columnLookup.resize(type->m_typeId + 1, INVALID_INDEX);
+
+            m_columnLookup[type->m_typeId] = m_columns.size();
+            m_columns.push_back({ type, 0 });
+            m_types.push_back(type->m_typeId);
+
+            rowSize += type->m_size;
+        }
+
+        // Fit as many rows as possible in a chunk - the columns' alignment padding may require a few less than the ideal count
+        m_chunkCapacity = std::max<size_t>(CHUNK_SIZE / rowSize, 1);
+
+        while (computeLayout() > CHUNK_SIZE && m_chunkCapacity > 1)
+            --m_chunkCapacity;
+
+        m_chunkSize = std::max(CHUNK_SIZE, computeLayout());
+    }
+
+    Archetype::Archetype(Archetype&& other) noexcept
+        : m_columns(std::move(other.m_columns)), m_types(std::move(other.m_types)),
+        m_columnLookup(std::move(other.m_columnLookup)), m_addEdges(std::move(other.m_addEdges)),
+        m_removeEdges(std::move(other.m_removeEdges)), m_chunks(std::move(other.m_chunks)),
+        m_chunkCapacity(other.m_chunkCapacity), m_chunkSize(other.m_chunkSize), m_count(other.m_count)
+    {
+        other.m_count = 0;
+    }
+
+    Archetype::~Archetype()
+    {
+        for (Index row = 0; row < m_count; ++row)
+            destroyRow(row);
+    }
+
+    Archetype& Archetype::operator=(Archetype&& other) noexcept
+    {
+        if (&other == this)
+            return *this;
+
+        for (Index row = 0; row < m_count; ++row)
+            destroyRow(row);
+
+        m_columns       = std::move(other.m_columns);
+        m_types         = std::move(other.m_types);
+        m_columnLookup  = std::move(other.m_columnLookup);
+        m_addEdges      = std::move(other.m_addEdges);
+        m_removeEdges   = std::move(other.m_removeEdges);
+        m_chunks        = std::move(other.m_chunks);
+        m_chunkCapacity = other.m_chunkCapacity;
+        m_chunkSize     = other.m_chunkSize;
+        m_count         = other.m_count;
+
+        other.m_count = 0;
+
+        return *this;
+    }
+
+    const std::vector<Archetype::TypeId>& Archetype::getTypes() const
+    {
+        return m_types;
+    }
+
+    Archetype::Index Archetype::getColumnIndex(const TypeId typeId) const
+    {
+        return typeId < m_columnLookup.size() ? m_columnLookup[typeId] : INVALID_INDEX;
+    }
+
+    size_t Archetype::getColumnCount() const
+    {
+        return m_columns.size();
+    }
+
+    const Archetype::ColumnType& Archetype::getColumnType(const Index column) const
+    {
+        ASSERT(column < m_columns.size());
+        return *m_columns[column].m_type;
+    }
+
+    size_t Archetype::getCount() const
+    {
+        return m_count;
+    }
+
+    size_t Archetype::getChunkCapacity() const
+    {
+        return m_chunkCapacity;
+    }
+
+    size_t Archetype::getChunkCount() const
+    {
+        return (m_count + m_chunkCapacity - 1) / m_chunkCapacity;
+    }
+
+    size_t Archetype::getChunkSize(const Index chunk) const
+    {
+        const size_t first = chunk * m_chunkCapacity;
+        return first < m_count ? std::min(m_chunkCapacity, m_count - first) : 0;
+    }
+
+    const Entity* Archetype::getEntities(const Index chunk) const
+    {
+        ASSERT(chunk < m_chunks.size());
+        return reinterpret_cast<const Entity*>(m_chunks[chunk].get());
+    }
+
+    std::byte* Archetype::getColumn(const Index chunk, const Index column)
+    {
+        ASSERT(chunk < m_chunks.size() && column < m_columns.size());
+        return m_chunks[chunk].get() + m_columns[column].m_offset;
+    }
+
+    Entity Archetype::getEntity(const Index row) const
+    {
+        ASSERT(row < m_count);
+        return getEntities(row / m_chunkCapacity)[row % m_chunkCapacity];
+    }
+
+    void* Archetype::getComponent(const Index row, const Index column)
+    {
+        return getColumn(row / m_chunkCapacity, column) + row % m_chunkCapacity * m_columns[column].m_type->m_size;
+    }
+
+    const void* Archetype::getComponent(const Index row, const Index column) const
+    {
+        return const_cast<Archetype*>(this)->getComponent(row, column);
+    }
+
+    Archetype::Index Archetype::findRow(const Index column, const void* component) const
+    {
+        const size_t     size    = m_columns[column].m_type->m_size;
+        const std::byte* address = static_cast<const std::byte*>(component);
+
+        for (Index chunk = 0; chunk < getChunkCount(); ++chunk)
+        {
+            const std::byte* first = m_chunks[chunk].get() + m_columns[column].m_offset;
+            const std::byte* last  = first + getChunkSize(chunk) * size;
+
+            if (address >= first && address < last)
+                return chunk * m_chunkCapacity + static_cast<size_t>(address - first) / size;
+        }
+
+        return INVALID_INDEX;
+    }
+
+    size_t Archetype::computeLayout()
+    {
+        size_t offset = sizeof(Entity) * m_chunkCapacity;
+
+        for (Column& column : m_columns)
+        {
+            const size_t alignment = column.m_type->m_alignment;
+
+            column.m_offset = (offset + alignment - 1) / alignment * alignment;
+            offset          = column.m_offset + column.m_type->m_size * m_chunkCapacity;
+        }
+
+        return offset;
+    }
+
+    Archetype::Index Archetype::addRow(const Entity owner)
+    {
+        const Index row   = m_count;
+        const Index chunk = row / m_chunkCapacity;
+
+        if (chunk >= m_chunks.size())
+            m_chunks.push_back(std::make_unique_for_overwrite<std::byte[]>(m_chunkSize));
+
+        new(m_chunks[chunk].get() + row % m_chunkCapacity * sizeof(Entity)) Entity(owner);
+        ++m_count;
+
+        return row;
+    }
+
+    Entity Archetype::eraseRow(const Index row)
+    {
+        ASSERT(row < m_count);
+
+        const Index last  = m_count - 1;
+        Entity      moved = NULL_ENTITY;
+
+        if (row != last)
+        {
+            for (Index column = 0; column < m_columns.size(); ++column)
+                m_columns[column].m_type->relocate(getComponent(row, column), getComponent(last, column));
+
+            moved = getEntity(last);
+            reinterpret_cast<Entity*>(m_chunks[row / m_chunkCapacity].get())[row % m_chunkCapacity] = moved;
+        }
+
+        --m_count;
+
+        // Keep a spare chunk to avoid reallocating when an entity goes back and forth across a chunk boundary
+        if (m_chunks.size() > getChunkCount() + 1)
+            m_chunks.pop_back();
+
+        return moved;
+    }
+
+    void Archetype::destroyRow(const Index row)
+    {
+        for (Index column = 0; column < m_columns.size(); ++column)
+        {
+            if (const ColumnType& type = *m_columns[column].m_type; type.destroy)
+                type.destroy(getComponent(row, column));
+        }
+    }
+
+    void Archetype::clear()
+    {
+        for (Index row = 0; row < m_count; ++row)
+            destroyRow(row);
+
+        m_count = 0;
+        m_chunks.resize(std::min<size_t>(m_chunks.size(), 1));
+    }
+}
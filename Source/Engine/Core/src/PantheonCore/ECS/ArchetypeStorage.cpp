@@ -0,0 +1,332 @@
+#include "PantheonCore/ECS/ArchetypeStorage.h"
+
+#include "PantheonCore/ECS/EntityHandle.h"
+#include "PantheonCore/Debug/Assertion.h"
+
+#include <algorithm>
+
+namespace PantheonCore::ECS
+{
+    ArchetypeStorage::ArchetypeStorage(Scene* scene)
+        : m_scene(scene), m_count(0)
+    {
+        m_archetypes.emplace_back(std::vector<const Archetype::ColumnType*>{});
+        m_archetypeIds.emplace(TypeSet{}, ROOT_ARCHETYPE);
+    }
+
+    bool ArchetypeStorage::contains(const Entity owner) const
+    {
+        return findRecord(owner) != nullptr;
+    }
+
+    bool ArchetypeStorage::copy(const Entity source, const Entity target)
+    {
+        return !findRecord(target) && copyRange(source, &target, &target + 1);
+    }
+
+    bool ArchetypeStorage::copyRange(const Entity source, const Entity* first, const Entity* last)
+    {
+        const Record* sourceRecord = findRecord(source);
+
+        if (!sourceRecord)
+            return false;
+
+        const Index archetypeIndex = sourceRecord->m_archetype;
+        const Index sourceRow      = sourceRecord->m_row;
+
+        Archetype&          archetype = m_archetypes[archetypeIndex];
+        std::vector<Entity> added;
+
+        added.reserve(static_cast<size_t>(last - first));
+
+        for (const Entity* target = first; target != last; ++target)
+        {
+            if (findRecord(*target))
+                continue;
+
+            const Index row = archetype.addRow(*target);
+
+            for (Index column = 0; column < archetype.getColumnCount(); ++column)
+                archetype.getColumnType(column).copy(archetype.getComponent(row, column), archetype.getComponent(sourceRow, column));
+
+            getRecord(*target) = { archetypeIndex, row };
+            added.push_back(*target);
+            ++m_count;
+        }
+
+        // The add hooks may modify the entities' components - look each of them up again before invoking its hook
+        for (const Entity target : added)
+        {
+            for (Index column = 0; column < m_archetypes[archetypeIndex].getColumnCount(); ++column)
+            {
+                const Archetype::ColumnType& type = m_archetypes[archetypeIndex].getColumnType(column);
+
+                if (void* component = findComponent(target, type.m_typeId))
+                    type.onAdd({ m_scene, target }, component);
+            }
+        }
+
+        return true;
+    }
+
+    void ArchetypeStorage::remove(const Entity owner)
+    {
+        const Record* record = findRecord(owner);
+
+        if (!record)
+            return;
+
+        const Index archetypeIndex = record->m_archetype;
+
+        for (Index column = 0; column < m_archetypes[archetypeIndex].getColumnCount(); ++column)
+        {
+            const Archetype::ColumnType& type = m_archetypes[archetypeIndex].getColumnType(column);
+
+            if (void* component = findComponent(owner, type.m_typeId))
+                type.onRemove({ m_scene, owner }, component);
+        }
+
+        // The remove hooks may have modified the entity's components
+        if (findRecord(owner))
+            move(getRecord(owner), ROOT_ARCHETYPE, INVALID_INDEX);
+    }
+
+    void ArchetypeStorage::clear()
+    {
+        for (Archetype& archetype : m_archetypes)
+            archetype.clear();
+
+        m_records.clear();
+        m_count = 0;
+    }
+
+    size_t ArchetypeStorage::getCount() const
+    {
+        return m_count;
+    }
+
+    size_t ArchetypeStorage::getArchetypeCount() const
+    {
+        return m_archetypes.size();
+    }
+
+    Archetype& ArchetypeStorage::getArchetype(const Index index)
+    {
+        ASSERT(index < m_archetypes.size());
+        return m_archetypes[index];
+    }
+
+    const Archetype& ArchetypeStorage::getArchetype(const Index index) const
+    {
+        ASSERT(index < m_archetypes.size());
+        return m_archetypes[index];
+    }
+
+    ArchetypeStorage::Index ArchetypeStorage::findArchetype(const Entity owner) const
+    {
+        const Record* record = findRecord(owner);
+        return record ? record->m_archetype : INVALID_INDEX;
+    }
+
+    const std::vector<ArchetypeStorage::Index>& ArchetypeStorage::query(TypeSet types) const
+    {
+        std::ranges::sort(types);
+        types.erase(std::ranges::unique(types).begin(), types.end());
+
+        std::lock_guard lock(m_queryMutex);
+
+        if (const auto it = m_queries.find(types); it != m_queries.end())
+            return it->second;
+
+        std::vector<Index> matches;
+
+        for (Index index = 0; index < m_archetypes.size(); ++index)
+        {
+            const Archetype& archetype = m_archetypes[index];
+
+            if (!archetype.getTypes().empty() && std::ranges::includes(archetype.getTypes(), types))
+                matches.push_back(index);
+        }
+
+        return m_queries.emplace(std::move(types), std::move(matches)).first->second;
+    }
+
+    const ArchetypeStorage::Record* ArchetypeStorage::findRecord(const Entity owner) const
+    {
+        const Entity::Id index = owner.getIndex();
+
+        if (index >= m_records.size())
+            return nullptr;
+
+        const Record& record = m_records[index];
+
+        if (record.m_archetype == INVALID_INDEX)
+            return nullptr;
+
+        const Archetype& archetype = m_archetypes[record.m_archetype];
+        return record.m_row < archetype.getCount() && archetype.getEntity(record.m_row) == owner ? &record : nullptr;
+    }
+
+    ArchetypeStorage::Record& ArchetypeStorage::getRecord(const Entity owner)
+    {
+        const Entity::Id index = owner.getIndex();
+
+        if (index >= m_records.size())
+            m_records.resize(index + 1);
+
+        return m_records[index];
+    }
+
+    void* ArchetypeStorage::findComponent(const Entity owner, const TypeId typeId) const
+    {
+        const Record* record = findRecord(owner);
+
+        if (!record)
+            return nullptr;
+
+        // Components are owned by the scene - constness is handled by the public accessors
+        Archetype&  archetype = const_cast<Archetype&>(m_archetypes[record->m_archetype]);
+        const Index column    = archetype.getColumnIndex(typeId);
+
+        return column != INVALID_INDEX ? archetype.getComponent(record->m_row, column) : nullptr;
+    }
+
+    ArchetypeStorage::Index ArchetypeStorage::getAddEdge(const Index archetype, const Archetype::ColumnType& type)
+    {
+        const TypeId typeId = type.m_typeId;
+
+        if (typeId < m_archetypes[archetype].m_addEdges.size() && m_archetypes[archetype].m_addEdges[typeId] != INVALID_INDEX)
+            return m_archetypes[archetype].m_addEdges[typeId];
+
+        std::vector<const Archetype::ColumnType*> columnTypes;
+        columnTypes.reserve(m_archetypes[archetype].getColumnCount() + 1);
+
+        for (Index column = 0; column < m_archetypes[archetype].getColumnCount(); ++column)
+            columnTypes.push_back(&m_archetypes[archetype].getColumnType(column));
+
+        columnTypes.push_back(&type);
+
+        // Creating the target archetype may reallocate the archetypes array - only fetch the edges afterward
+        const Index target = getOrCreateArchetype(std::move(columnTypes));
+
+        std::vector<Index>& addEdges = m_archetypes[archetype].m_addEdges;
+
+        if (typeId >= addEdges.size())
+            addEdges.resize(typeId + 1, INVALID_INDEX);
+
+        addEdges[typeId] = target;
+
+        std::vector<Index>& removeEdges = m_archetypes[target].m_removeEdges;
+
+        if (typeId >= removeEdges.size())
+            removeEdges.resize(typeId + 1, INVALID_INDEX);
+
+        removeEdges[typeId] = archetype;
+
+        return target;
+    }
+
+    ArchetypeStorage::Index ArchetypeStorage::getRemoveEdge(const Index archetype, const TypeId typeId)
+    {
+        if (typeId < m_archetypes[archetype].m_removeEdges.size() && m_archetypes[archetype].m_removeEdges[typeId] != INVALID_INDEX)
+            return m_archetypes[archetype].m_removeEdges[typeId];
+
+        std::vector<const Archetype::ColumnType*> columnTypes;
+        columnTypes.reserve(m_archetypes[archetype].getColumnCount());
+
+        for (Index column = 0; column < m_archetypes[archetype].getColumnCount(); ++column)
+        {
+            const Archetype::ColumnType& type = m_archetypes[archetype].getColumnType(column);
+
+            if (type.m_typeId != typeId)
+                columnTypes.push_back(&type);
+        }
+
+        const Index target = getOrCreateArchetype(std::move(columnTypes));
+
+        std::vector<Index>& removeEdges = m_archetypes[archetype].m_removeEdges;
+
+        if (typeId >= removeEdges.size())
+            removeEdges.resize(typeId + 1, INVALID_INDEX);
+
+        removeEdges[typeId] = target;
+
+        std::vector<Index>& addEdges = m_archetypes[target].m_addEdges;
+
+        if (typeId >= addEdges.size())
+            addEdges.resize(typeId + 1, INVALID_INDEX);
+
+        addEdges[typeId] = archetype;
+
+        return target;
+    }
+
+    ArchetypeStorage::Index ArchetypeStorage::getOrCreateArchetype(std::vector<const Archetype::ColumnType*> columnTypes)
+    {
+        std::ranges::sort(columnTypes, {}, &Archetype::ColumnType::m_typeId);
+
+        TypeSet types;
+        types.reserve(columnTypes.size());
+
+        for (const Archetype::ColumnType* type : columnTypes)
+            types.push_back(type->m_typeId);
+
+        if (const auto it = m_archetypeIds.find(types); it != m_archetypeIds.end())
+            return it->second;
+
+        const Index      index     = m_archetypes.size();
+        const Archetype& archetype = m_archetypes.emplace_back(columnTypes);
+
+        // Keep the cached queries up to date - views hold on to their matches
+        std::lock_guard lock(m_queryMutex);
+
+        for (auto& [queryTypes, matches] : m_queries)
+        {
+            if (std::ranges::includes(archetype.getTypes(), queryTypes))
+                matches.push_back(index);
+        }
+
+        m_archetypeIds.emplace(std::move(types), index);
+        return index;
+    }
+
+    void ArchetypeStorage::move(Record& record, const Index target, const Index row)
+    {
+        if (record.m_archetype == INVALID_INDEX)
+        {
+            ++m_count;
+            record = { target, row };
+            return;
+        }
+
+        Archetype& source      = m_archetypes[record.m_archetype];
+        Archetype& destination = m_archetypes[target];
+
+        for (Index column = 0; column < source.getColumnCount(); ++column)
+        {
+            const Archetype::ColumnType& type         = source.getColumnType(column);
+            void*                        component    = source.getComponent(record.m_row, column);
+            const Index                  targetColumn = destination.getColumnIndex(type.m_typeId);
+
+            if (targetColumn != INVALID_INDEX)
+                type.relocate(destination.getComponent(row, targetColumn), component);
+            else if (type.destroy)
+                type.destroy(component);
+        }
+
+        // The source archetype fills the hole with its last row - update the moved entity's record
+        const Entity moved = source.eraseRow(record.m_row);
+
+        if (moved != NULL_ENTITY)
+            m_records[moved.getIndex()].m_row = record.m_row;
+
+        if (target == ROOT_ARCHETYPE)
+        {
+            --m_count;
+            record = {};
+            return;
+        }
+
+        record = { target, row };
+    }
+}
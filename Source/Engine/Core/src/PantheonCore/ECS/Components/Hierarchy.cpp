@@ -2,6 +2,8 @@
 
 #include "PantheonCore/ECS/SceneView.h"
 
+#include <limits>
+
 using namespace LibMath;
 using namespace PantheonCore::Serialization;
 
@@ -42,6 +44,33 @@ namespace PantheonCore::ECS
         return m_childCount;
     }
 
+    namespace
+    {
+        /**
+         * \brief Calls the given function for each of the transforms linked to the given entity (i.e. the transforms of
+         * its descendants that don't have an ancestor with a transform below the given entity)
+         * \param entity The entity for which the linked transforms should be visited
+         * \param func The function to call for each linked transform
+         */
+        template <typename Func>
+        void VisitChildTransforms(const EntityHandle entity, Func&& func)
+        {
+            for (const EntityHandle child : entity.children())
+            {
+                child.visitDepthFirst([&func](EntityHandle descendant)
+                {
+                    if (Transform* transform = descendant.get<Transform>())
+                    {
+                        func(*transform);
+                        return EntityHandle::EVisitResult::SKIP_CHILDREN;
+                    }
+
+                    return EntityHandle::EVisitResult::CONTINUE;
+                });
+            }
+        }
+    }
+
     void LinkTransforms(EntityHandle entity)
     {
         Transform* parentTransform = entity.getParent().getInParent<Transform>();
@@ -50,54 +79,106 @@ namespace PantheonCore::ECS
         if (transform)
             transform->setParent(parentTransform, parentTransform == nullptr);
 
-        const std::vector<Transform*> childTransforms = GetChildTransforms(entity);
+        Transform* newParent = transform ? transform : parentTransform;
 
-        for (Transform* childTransform : childTransforms)
+        VisitChildTransforms(entity, [newParent, parentTransform](Transform& childTransform)
         {
-            Transform* newParent = transform ? transform : parentTransform;
-            childTransform->setParent(newParent, parentTransform == nullptr);
-        }
+            childTransform.setParent(newParent, parentTransform == nullptr);
+        });
     }
 
     void UnlinkTransforms(const EntityHandle entity)
     {
         Transform* parentTransform = entity.getParent().getInParent<Transform>();
 
-        const std::vector<Transform*> linkedTransforms = GetChildTransforms(entity);
-
-        for (Transform* transform : linkedTransforms)
-            transform->setParent(parentTransform, true);
+        VisitChildTransforms(entity, [parentTransform](Transform& childTransform)
+        {
+            childTransform.setParent(parentTransform, true);
+        });
     }
 
     std::vector<Transform*> GetChildTransforms(const EntityHandle entity)
     {
         std::vector<Transform*> linkedTransforms;
 
-        const std::vector<EntityHandle> children = entity.getChildren();
+        VisitChildTransforms(entity, [&linkedTransforms](Transform& childTransform)
+        {
+            linkedTransforms.push_back(&childTransform);
+        });
+
+        return linkedTransforms;
+    }
+
+    void CloneHierarchies(Scene& scene, const std::vector<Entity>& subtree, const Entity* instances, const size_t count)
+    {
+        constexpr size_t INVALID_NODE = std::numeric_limits<size_t>::max();
+
+        ComponentStorage<HierarchyComponent>& storage = scene.getStorage<HierarchyComponent>();
 
-        for (EntityHandle child : children)
+        std::unordered_map<Entity::Id, size_t> nodes;
+        nodes.reserve(subtree.size());
+
+        for (size_t node = 0; node < subtree.size(); ++node)
+            nodes.emplace(subtree[node], node);
+
+        const auto findNode = [&nodes](const Entity entity)
         {
-            if (Transform* childTransform = child.get<Transform>())
-            {
-                linkedTransforms.push_back(childTransform);
-            }
-            else
+            const auto it = nodes.find(entity);
+            return it != nodes.end() ? it->second : INVALID_NODE;
+        };
+
+        std::vector<HierarchyComponent> hierarchies;
+        hierarchies.reserve(subtree.size() * count);
+
+        for (size_t node = 0; node < subtree.size(); ++node)
+        {
+            const HierarchyComponent* source = storage.find(subtree[node]);
+            ASSERT(source, "Unable to clone hierarchies - Subtree entity %llu doesn't have a hierarchy", subtree[node].getIndex());
+
+            // The root's parent and siblings are outside of the subtree - its copies are detached
+            const bool   isRoot          = node == 0;
+            const size_t parent          = isRoot ? INVALID_NODE : findNode(source->m_parent);
+            const size_t firstChild      = findNode(source->m_firstChild);
+            const size_t previousSibling = isRoot ? INVALID_NODE : findNode(source->m_previousSibling);
+            const size_t nextSibling     = isRoot ? INVALID_NODE : findNode(source->m_nextSibling);
+
+            for (size_t instance = 0; instance < count; ++instance)
             {
-                const std::vector<Transform*> childTransforms = GetChildTransforms(child);
-                linkedTransforms.insert(linkedTransforms.end(), childTransforms.begin(), childTransforms.end());
+                const auto remap = [instances, count, instance](const size_t target)
+                {
+                    return target != INVALID_NODE ? instances[target * count + instance] : NULL_ENTITY;
+                };
+
+                HierarchyComponent& hierarchy = hierarchies.emplace_back(remap(parent));
+
+                hierarchy.m_firstChild      = remap(firstChild);
+                hierarchy.m_previousSibling = remap(previousSibling);
+                hierarchy.m_nextSibling     = remap(nextSibling);
+                hierarchy.m_childCount      = source->m_childCount;
             }
         }
 
-        return linkedTransforms;
+        // The copies are already linked together - skip the hooks, which would link them again, but notify the listeners
+        const Entity* last = instances + hierarchies.size();
+        storage.insertRange(instances, last, std::make_move_iterator(hierarchies.begin()), false);
+
+        for (const Entity* instance = instances; instance != last; ++instance)
+        {
+            if (HierarchyComponent* hierarchy = storage.find(*instance))
+                storage.m_onAdd.invoke({ &scene, *instance }, *hierarchy);
+        }
     }
 
     template <>
     void ComponentTraits::onAdd<HierarchyComponent>(const EntityHandle owner, HierarchyComponent& hierarchy)
     {
-        ASSERT(hierarchy.m_firstChild == NULL_ENTITY, "Adding a pre-existing hierarchy is not supported");
+        // Components added in a batch (e.g. when deserializing a scene) may already have been linked to by their children
+        [[maybe_unused]] const EntityHandle firstChild(owner.getScene(), hierarchy.m_firstChild);
+
+        ASSERT(!firstChild || firstChild.getParent().getEntity() == owner.getEntity(), "Adding a pre-existing hierarchy is not supported");
+        ASSERT((hierarchy.m_firstChild == NULL_ENTITY) == (hierarchy.m_childCount == 0), "Adding a pre-existing hierarchy is not supported");
         ASSERT(hierarchy.m_previousSibling == NULL_ENTITY, "Adding a pre-existing hierarchy is not supported");
         ASSERT(hierarchy.m_nextSibling == NULL_ENTITY, "Adding a pre-existing hierarchy is not supported");
-        ASSERT(hierarchy.m_childCount == 0, "Adding a pre-existing hierarchy is not supported");
 
         onChange(owner, hierarchy);
     }
@@ -109,18 +190,26 @@ namespace PantheonCore::ECS
 
         EntityHandle child(entity.getScene(), hierarchy.m_firstChild);
 
-        hierarchy.m_parent          = NULL_ENTITY;
-        hierarchy.m_nextSibling     = NULL_ENTITY;
-        hierarchy.m_previousSibling = NULL_ENTITY;
-
+        // Destroy the subtrees leaves first - the destroyed entities never have children left to unlink
         while (child)
         {
             const EntityHandle nextChild = child.getNextSibling();
-            child.destroy();
+
+            child.visitPostOrder([](EntityHandle descendant)
+            {
+                descendant.destroy();
+            });
+
             child = nextChild;
         }
 
-        hierarchy.m_childCount = 0;
+        // Destroying the children removed their own hierarchies from the storage, which may have moved this one
+        if (HierarchyComponent* current = EntityHandle(entity).get<HierarchyComponent>())
+        {
+            current->m_firstChild = NULL_ENTITY;
+            current->m_childCount = 0;
+        }
+
         UnlinkTransforms(entity);
     }
 
@@ -164,6 +253,10 @@ namespace PantheonCore::ECS
         if (EntityHandle firstChild(scene, hierarchy.m_firstChild); firstChild && !firstChild.has<HierarchyComponent>())
             firstChild.make<HierarchyComponent>(entity);
 
+        // The sibling links were cleared when unlinking from the previous parent - don't restore stale ones from the new value
+        hierarchy.m_previousSibling = NULL_ENTITY;
+        hierarchy.m_nextSibling     = NULL_ENTITY;
+
         if (!parent)
             return;
 
@@ -32,15 +32,10 @@ namespace PantheonCore::ECS
 
     EntityHandle EntityHandle::getRoot() const
     {
-        EntityHandle parent = *this;
-        EntityHandle root;
+        EntityHandle root = *this;
 
-        do
-        {
-            root   = parent;
-            parent = parent.getParent();
-        }
-        while (parent);
+        for (const EntityHandle ancestor : ancestors())
+            root = ancestor;
 
         return root;
     }
@@ -54,16 +49,25 @@ namespace PantheonCore::ECS
 
     void EntityHandle::setParent(const EntityHandle parent)
     {
-        HierarchyComponent* hierarchy = get<HierarchyComponent>();
+        const HierarchyComponent* current = get<HierarchyComponent>();
 
-        if (!hierarchy)
+        if (!current)
         {
             make<HierarchyComponent>(parent);
             return;
         }
 
-        hierarchy->setParent(parent);
-        set<HierarchyComponent>(*hierarchy);
+        // The stored hierarchy must keep its current links until the change hooks unlink it from its previous parent
+        HierarchyComponent hierarchy = *current;
+        hierarchy.setParent(parent);
+        set<HierarchyComponent>(hierarchy);
+    }
+
+    EntityHandle EntityHandle::getFirstChild() const
+    {
+        const HierarchyComponent* hierarchy = get<HierarchyComponent>();
+
+        return { m_scene, hierarchy ? hierarchy->getFirstChild() : NULL_ENTITY };
     }
 
     EntityHandle EntityHandle::getNextSibling() const
@@ -89,38 +93,41 @@ namespace PantheonCore::ECS
 
     EntityHandle EntityHandle::getChild(size_t index) const
     {
-        const HierarchyComponent* hierarchy = get<HierarchyComponent>();
-
-        if (!hierarchy || hierarchy->getChildCount() <= index)
-            return { m_scene, NULL_ENTITY };
-
-        EntityHandle child = { m_scene, hierarchy->getFirstChild() };
-
-        while (index-- > 0)
-            child = child.getNextSibling();
+        for (const EntityHandle child : children())
+        {
+            if (index-- == 0)
+                return child;
+        }
 
-        return child;
+        return { m_scene, NULL_ENTITY };
     }
 
     std::vector<EntityHandle> EntityHandle::getChildren() const
     {
-        const HierarchyComponent* hierarchy = get<HierarchyComponent>();
+        const size_t childCount = getChildCount();
 
-        if (!hierarchy || hierarchy->getChildCount() == 0)
+        if (childCount == 0)
             return {};
 
         std::vector<EntityHandle> children;
-        EntityHandle              child = { m_scene, hierarchy->getFirstChild() };
+        children.reserve(childCount);
 
-        while (child)
-        {
+        for (const EntityHandle child : this->children())
             children.push_back(child);
-            child = child.getNextSibling();
-        }
 
         return children;
     }
 
+    HierarchyRange EntityHandle::children() const
+    {
+        return HierarchyRange({ m_scene, getFirstChild().m_entity, HierarchyIterator::ELink::NEXT_SIBLING });
+    }
+
+    HierarchyRange EntityHandle::ancestors() const
+    {
+        return HierarchyRange({ m_scene, getParent().m_entity, HierarchyIterator::ELink::PARENT });
+    }
+
     EntityHandle EntityHandle::copy() const
     {
         if (*this)
@@ -136,4 +143,10 @@ namespace PantheonCore::ECS
 
         m_entity = NULL_ENTITY;
     }
+
+    std::vector<Entity>& EntityHandle::getTraversalQueue()
+    {
+        thread_local std::vector<Entity> queue;
+        return queue;
+    }
 }
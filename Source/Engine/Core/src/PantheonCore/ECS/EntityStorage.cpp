@@ -2,6 +2,8 @@
 #include "PantheonCore/ECS/EntityHandle.h"
 #include "PantheonCore/ECS/Scene.h"
 
+#include <utility>
+
 namespace PantheonCore::ECS
 {
     EntityStorage::EntityStorage(Scene* scene)
@@ -11,11 +13,23 @@ namespace PantheonCore::ECS
 
     Entity EntityStorage::add()
     {
-        if (m_entities.size() == m_count)
-            return m_entities.emplace_back(m_count++, Entity::Version{});
+        Entity entity;
+
+        if (m_freeList == Entity::INDEX_MASK)
+        {
+            entity = m_entities.emplace_back(static_cast<Entity::Id>(m_entities.size()), Entity::Version{});
+        }
+        else
+        {
+            // Free slots store the next free index along with the version of their next occupant
+            const Entity::Id index = m_freeList;
+            Entity&          slot  = m_entities[index];
 
-        Entity& entity = m_entities[m_count++];
-        entity.bumpVersion();
+            m_freeList = slot.getIndex();
+            entity     = slot = Entity(index, slot.getVersion());
+        }
+
+        ++m_count;
 
         m_onAdd.invoke({ m_scene, entity });
         return entity;
@@ -23,26 +37,37 @@ namespace PantheonCore::ECS
 
     void EntityStorage::remove(const Entity entity)
     {
-        const auto it = std::ranges::find(*this, entity);
+        if (!has(entity))
+            return;
 
-        if (it == end())
+        m_onRemove.invoke({ m_scene, entity });
+
+        // The remove callbacks may have already destroyed the entity
+        if (!has(entity))
             return;
 
-        m_onRemove.invoke({ m_scene, *it });
+        const Entity::Id index = entity.getIndex();
+        Entity&          slot  = m_entities[index];
 
-        std::swap(*it, m_entities[m_count - 1]);
+        slot.bumpVersion();
         --m_count;
-    }
 
-    bool EntityStorage::has(const Entity entity) const
-    {
-        return std::ranges::find(*this, entity) != end();
+        // Retire slots whose version is exhausted instead of recycling them to keep stale handles invalid
+        if (slot.getVersion() == Entity::VERSION_MASK)
+        {
+            slot = NULL_ENTITY;
+            return;
+        }
+
+        slot       = Entity(m_freeList, slot.getVersion());
+        m_freeList = index;
     }
 
     void EntityStorage::clear()
     {
         m_entities.clear();
-        m_count = 0;
+        m_freeList = Entity::INDEX_MASK;
+        m_count    = 0;
     }
 
     void EntityStorage::reserve(const size_t count)
@@ -50,24 +75,42 @@ namespace PantheonCore::ECS
         m_entities.reserve(count);
     }
 
+    void EntityStorage::toSnapshot(SceneSnapshot& snapshot) const
+    {
+        snapshot.write(m_entities.data(), m_entities.size());
+        snapshot.write(m_freeList);
+        snapshot.write(m_count);
+    }
+
+    void EntityStorage::fromSnapshot(SceneSnapshot::Reader& reader)
+    {
+        const std::span<const Entity> entities = reader.read<Entity>();
+
+        m_entities.assign(entities.begin(), entities.end());
+        m_freeList = reader.readValue<Entity::Id>();
+        m_count    = reader.readValue<Entity::Id>();
+    }
+
     EntityStorage::iterator EntityStorage::begin()
     {
-        return m_entities.begin();
+        return std::as_const(*this).begin();
     }
 
     EntityStorage::iterator EntityStorage::end()
     {
-        return m_entities.end() - static_cast<iterator::difference_type>(m_entities.size() - m_count);
+        return std::as_const(*this).end();
     }
 
     EntityStorage::const_iterator EntityStorage::begin() const
     {
-        return m_entities.begin();
+        const Entity* data = m_entities.data();
+        return { data, data, data + m_entities.size() };
     }
 
     EntityStorage::const_iterator EntityStorage::end() const
     {
-        return m_entities.end() - static_cast<const_iterator::difference_type>(m_entities.size() - m_count);
+        const Entity* last = m_entities.data() + m_entities.size();
+        return { last, m_entities.data(), last };
     }
 
     Entity::Id EntityStorage::getCount() const
@@ -0,0 +1,70 @@
+#include "PantheonCore/ECS/HierarchyIterator.h"
+
+#include "PantheonCore/ECS/EntityHandle.h"
+#include "PantheonCore/ECS/Components/Hierarchy.h"
+
+namespace PantheonCore::ECS
+{
+    HierarchyIterator::HierarchyIterator(Scene* scene, const Entity current, const ELink link)
+        : m_scene(scene), m_current(current), m_link(link)
+    {
+        if (m_scene && m_current != NULL_ENTITY)
+            m_hierarchies = &static_cast<const Scene*>(m_scene)->getStorage<HierarchyComponent>();
+        else
+            m_current = NULL_ENTITY;
+    }
+
+    EntityHandle HierarchyIterator::operator*() const
+    {
+        return { m_scene, m_current };
+    }
+
+    HierarchyIterator& HierarchyIterator::operator++()
+    {
+        const HierarchyComponent* hierarchy = m_hierarchies->find(m_current);
+
+        if (!hierarchy)
+            m_current = NULL_ENTITY;
+        else
+            m_current = m_link == ELink::PARENT ? hierarchy->getParent() : hierarchy->getNextSibling();
+
+        return *this;
+    }
+
+    HierarchyIterator HierarchyIterator::operator++(int)
+    {
+        HierarchyIterator tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    bool HierarchyIterator::operator==(const HierarchyIterator& other) const
+    {
+        return m_current == other.m_current;
+    }
+
+    bool HierarchyIterator::operator!=(const HierarchyIterator& other) const
+    {
+        return !(*this == other);
+    }
+
+    HierarchyRange::HierarchyRange(HierarchyIterator begin)
+        : m_begin(std::move(begin))
+    {
+    }
+
+    HierarchyIterator HierarchyRange::begin() const
+    {
+        return m_begin;
+    }
+
+    HierarchyIterator HierarchyRange::end() const
+    {
+        return {};
+    }
+
+    bool HierarchyRange::empty() const
+    {
+        return m_begin == end();
+    }
+}
@@ -1,7 +1,10 @@
 #include "PantheonCore/ECS/Scene.h"
 
+#include "PantheonCore/ECS/ArchetypeStorage.h"
 #include "PantheonCore/ECS/ComponentRegistry.h"
+#include "PantheonCore/ECS/Components/Hierarchy.h"
 
+#include <algorithm>
 #include <ranges>
 
 #include <rapidjson/istreamwrapper.h>
@@ -9,10 +12,17 @@
 namespace PantheonCore::ECS
 {
     Scene::Scene()
-        : m_entities(this)
+        : Scene(EStorageMode::SPARSE_SET)
     {
     }
 
+    Scene::Scene(const EStorageMode storageMode)
+        : m_entities(this), m_tick(1), m_isFrozen(false)
+    {
+        if (storageMode == EStorageMode::ARCHETYPE)
+            m_archetypes = std::make_unique<ArchetypeStorage>(this);
+    }
+
     bool Scene::load(const std::string& fileName)
     {
         std::ifstream fs(fileName);
@@ -39,6 +49,9 @@ namespace PantheonCore::ECS
 
     bool Scene::toBinary(std::vector<char>& output) const
     {
+        if (!CHECK(!m_archetypes || m_archetypes->getCount() == 0, "Unable to serialize scene - Archetype components can't be serialized"))
+            return false;
+
         if (!CHECK(writeNumber(m_entities.getCount(), output), "Unable to write scene entity count to memory buffer"))
             return false;
 
@@ -48,13 +61,20 @@ namespace PantheonCore::ECS
         for (const auto entity : m_entities)
             entitiesMap[entity] = Entity(index++);
 
-        const ElemCountT storageCount = static_cast<ElemCountT>(m_components.size());
+        const auto isSerialized = [](const std::unique_ptr<IComponentStorage>& storage)
+        {
+            return storage && storage->getCount() > 0;
+        };
+
+        const ElemCountT storageCount = static_cast<ElemCountT>(std::ranges::count_if(m_components, isSerialized));
         if (!CHECK(writeNumber(storageCount, output), "Unable to write scene entity count to memory buffer"))
             return false;
 
-        for (const auto& [typeId, storage] : m_components)
+        for (TypeId typeId = 0; typeId < m_components.size(); ++typeId)
         {
-            if (!storage || storage->getCount() == 0)
+            const std::unique_ptr<IComponentStorage>& storage = m_components[typeId];
+
+            if (!isSerialized(storage))
                 continue;
 
             const std::string& typeName = ComponentRegistry::getRegisteredTypeName(typeId);
@@ -73,6 +93,9 @@ namespace PantheonCore::ECS
     {
         clear();
 
+        if (!CHECK(!m_archetypes, "Unable to deserialize scene - Archetype scenes can't be deserialized"))
+            return 0;
+
         if (data == nullptr || length == 0)
             return 0;
 
@@ -114,6 +137,9 @@ namespace PantheonCore::ECS
 
     bool Scene::toJson(rapidjson::Writer<rapidjson::StringBuffer>& writer) const
     {
+        if (!CHECK(!m_archetypes || m_archetypes->getCount() == 0, "Unable to serialize scene - Archetype components can't be serialized"))
+            return false;
+
         writer.StartObject();
 
         writer.Key("entities");
@@ -128,8 +154,10 @@ namespace PantheonCore::ECS
         for (const auto entity : m_entities)
             entitiesMap[entity] = Entity(index++);
 
-        for (const auto& [typeId, storage] : m_components)
+        for (TypeId typeId = 0; typeId < m_components.size(); ++typeId)
         {
+            const std::unique_ptr<IComponentStorage>& storage = m_components[typeId];
+
             if (!storage || storage->getCount() == 0)
                 continue;
 
@@ -157,6 +185,9 @@ namespace PantheonCore::ECS
     {
         clear();
 
+        if (!CHECK(!m_archetypes, "Unable to deserialize scene - Archetype scenes can't be deserialized"))
+            return false;
+
         if (!CHECK(json.IsObject(), "Unable to deserialize scene - Json value should be an object"))
             return false;
 
@@ -190,30 +221,185 @@ namespace PantheonCore::ECS
 
     EntityHandle Scene::create()
     {
+        ASSERT(!m_isFrozen, "Unable to create entity - The scene is frozen");
         return { this, m_entities.add() };
     }
 
     EntityHandle Scene::create(const Entity source)
     {
+        ASSERT(!m_isFrozen, "Unable to create entity - The scene is frozen");
+
         if (!isValid(source))
             return create();
 
         Entity entity = m_entities.add();
 
-        for (const auto& componentStorage : m_components | std::views::values)
-            componentStorage->copy(source, entity);
+        for (const auto& componentStorage : m_components)
+        {
+            if (componentStorage)
+                componentStorage->copy(source, entity);
+        }
+
+        if (m_archetypes)
+            m_archetypes->copy(source, entity);
 
         return { this, entity };
     }
 
+    std::vector<Entity> Scene::instantiate(const Entity prefab, const size_t count)
+    {
+        ASSERT(!m_isFrozen, "Unable to instantiate prefab - The scene is frozen");
+
+        if (!isValid(prefab) || count == 0)
+            return {};
+
+        std::vector<Entity> subtree;
+
+        EntityHandle(this, prefab).visitDepthFirst([&subtree](const EntityHandle entity)
+        {
+            subtree.push_back(entity.getEntity());
+        });
+
+        // Group the instances by subtree entity - the copies of each entity form a contiguous range
+        std::vector<Entity> instances(subtree.size() * count);
+        m_entities.reserve(m_entities.getCount() + instances.size());
+
+        for (Entity& instance : instances)
+            instance = m_entities.add();
+
+        // Clone the hierarchies first - the other components' hooks (e.g. transforms) rely on them
+        const TypeId hierarchyTypeId = ComponentRegistry::getTypeId<HierarchyComponent>();
+
+        if (get<HierarchyComponent>(prefab))
+            CloneHierarchies(*this, subtree, instances.data(), count);
+
+        std::vector<IComponentStorage*> storages;
+
+        for (TypeId typeId = 0; typeId < m_components.size(); ++typeId)
+        {
+            IComponentStorage* storage = m_components[typeId].get();
+
+            if (!storage || typeId == hierarchyTypeId)
+                continue;
+
+            size_t ownedCount = 0;
+
+            for (const Entity entity : subtree)
+                ownedCount += storage->contains(entity);
+
+            if (ownedCount == 0)
+                continue;
+
+            storage->reserve(static_cast<Entity::Id>(storage->getCount() + ownedCount * count));
+            storages.push_back(storage);
+        }
+
+        for (size_t node = 0; node < subtree.size(); ++node)
+        {
+            const Entity* first = instances.data() + node * count;
+
+            for (IComponentStorage* storage : storages)
+                storage->copyRange(subtree[node], first, first + count);
+
+            if (m_archetypes)
+                m_archetypes->copyRange(subtree[node], first, first + count);
+        }
+
+        return { instances.begin(), instances.begin() + static_cast<std::ptrdiff_t>(count) };
+    }
+
     void Scene::destroy(const Entity entity)
     {
-        for (const auto& componentStorage : m_components | std::views::values)
-            componentStorage->remove(entity);
+        ASSERT(!m_isFrozen, "Unable to destroy entity - The scene is frozen");
+
+        if (!isValid(entity))
+            return;
+
+        for (const auto& componentStorage : m_components)
+        {
+            if (componentStorage)
+                componentStorage->remove(entity);
+        }
+
+        if (m_archetypes)
+            m_archetypes->remove(entity);
 
         m_entities.remove(entity);
     }
 
+    bool Scene::saveSnapshot(SceneSnapshot& snapshot) const
+    {
+        if (!CHECK(!m_archetypes, "Unable to save scene snapshot - Archetype storage isn't supported"))
+            return false;
+
+        snapshot.clear();
+
+        m_entities.toSnapshot(snapshot);
+        snapshot.write(m_tick);
+
+        const size_t storageCount = static_cast<size_t>(std::ranges::count_if(m_components, [](const auto& storage)
+        {
+            return storage != nullptr;
+        }));
+
+        snapshot.write(storageCount);
+
+        for (TypeId typeId = 0; typeId < m_components.size(); ++typeId)
+        {
+            if (!m_components[typeId])
+                continue;
+
+            snapshot.write(typeId);
+            m_components[typeId]->toSnapshot(snapshot);
+        }
+
+        return true;
+    }
+
+    bool Scene::restoreSnapshot(const SceneSnapshot& snapshot)
+    {
+        ASSERT(!m_isFrozen, "Unable to restore scene snapshot - The scene is frozen");
+
+        if (!CHECK(!m_archetypes, "Unable to restore scene snapshot - Archetype storage isn't supported")
+            || !CHECK(!snapshot.empty(), "Unable to restore scene snapshot - The snapshot is empty"))
+            return false;
+
+        SceneSnapshot::Reader reader(snapshot);
+
+        m_entities.fromSnapshot(reader);
+        m_tick = reader.readValue<Tick>();
+
+        const size_t      storageCount = reader.readValue<size_t>();
+        std::vector<bool> isRestored(m_components.size());
+
+        for (size_t i = 0; i < storageCount; ++i)
+        {
+            const TypeId                        typeId      = reader.readValue<TypeId>();
+            const SceneSnapshot::StorageFactory makeStorage = reader.readValue<SceneSnapshot::StorageFactory>();
+            std::unique_ptr<IComponentStorage>& storage     = getStorageSlot(typeId);
+
+            if (!storage)
+                storage = makeStorage(this);
+
+            storage->fromSnapshot(reader);
+
+            if (typeId >= isRestored.size())
+                isRestored.resize(typeId + 1);
+
+            isRestored[typeId] = true;
+        }
+
+        // Storages created after the capture were empty at the time
+        for (TypeId typeId = 0; typeId < m_components.size(); ++typeId)
+        {
+            if (m_components[typeId] && (typeId >= isRestored.size() || !isRestored[typeId]))
+                m_components[typeId]->clear();
+        }
+
+        refreshObservers();
+        return true;
+    }
+
     bool Scene::isValid(const Entity entity) const
     {
         return entity != NULL_ENTITY && m_entities.has(entity);
@@ -221,13 +407,19 @@ namespace PantheonCore::ECS
 
     void Scene::clear()
     {
-        for (auto& storage : m_components | std::views::values)
+        ASSERT(!m_isFrozen, "Unable to clear scene - The scene is frozen");
+
+        for (auto& storage : m_components)
         {
             if (storage)
                 storage->clear();
         }
 
+        if (m_archetypes)
+            m_archetypes->clear();
+
         m_entities.clear();
+        refreshObservers();
     }
 
     bool Scene::contains(const Entity owner) const
@@ -235,6 +427,113 @@ namespace PantheonCore::ECS
         return m_entities.has(owner);
     }
 
+    Scene::EStorageMode Scene::getStorageMode() const
+    {
+        return m_archetypes ? EStorageMode::ARCHETYPE : EStorageMode::SPARSE_SET;
+    }
+
+    ArchetypeStorage& Scene::getArchetypeStorage()
+    {
+        ASSERT(m_archetypes != nullptr, "Unable to get archetype storage - The scene doesn't use the archetype storage mode");
+        return *m_archetypes;
+    }
+
+    const ArchetypeStorage& Scene::getArchetypeStorage() const
+    {
+        ASSERT(m_archetypes != nullptr, "Unable to get archetype storage - The scene doesn't use the archetype storage mode");
+        return *m_archetypes;
+    }
+
+    void Scene::freeze()
+    {
+        ASSERT(!m_isFrozen, "Unable to freeze scene - The scene is already frozen");
+
+        if (m_accessStates.size() != m_components.size())
+            m_accessStates = std::vector<std::atomic<int32_t>>(m_components.size());
+
+        m_isFrozen = true;
+    }
+
+    void Scene::unfreeze()
+    {
+        ASSERT(m_isFrozen, "Unable to unfreeze scene - The scene isn't frozen");
+        ASSERT(std::ranges::all_of(m_accessStates, [](const std::atomic<int32_t>& state)
+        {
+            return state.load(std::memory_order_relaxed) == 0;
+        }), "Unable to unfreeze scene - A declared access is still active");
+
+        m_isFrozen = false;
+    }
+
+    bool Scene::isFrozen() const
+    {
+        return m_isFrozen;
+    }
+
+    void Scene::beginAccess([[maybe_unused]] const SceneAccess& access)
+    {
+        ASSERT(m_isFrozen, "Unable to begin scene access - The scene isn't frozen");
+
+#if defined(_DEBUG) || defined(PTH_VERBOSE_LOG)
+        // Storages created before the phase are the only ones that can be accessed - other types are always empty
+        for (const TypeId typeId : access.getReads())
+        {
+            if (typeId >= m_accessStates.size())
+                continue;
+
+            const int32_t state = m_accessStates[typeId].fetch_add(1, std::memory_order_acquire);
+            ASSERT(state >= 0, "Conflicting scene access - Component type %llu is already being written", typeId);
+        }
+
+        for (const TypeId typeId : access.getWrites())
+        {
+            if (typeId >= m_accessStates.size())
+                continue;
+
+            int32_t    state      = 0;
+            const bool isAcquired = m_accessStates[typeId].compare_exchange_strong(state, WRITE_ACCESS, std::memory_order_acquire);
+
+            ASSERT(isAcquired, "Conflicting scene access - Component type %llu is already being %s", typeId,
+                state < 0 ? "written" : "read");
+        }
+#endif
+    }
+
+    void Scene::endAccess([[maybe_unused]] const SceneAccess& access)
+    {
+#if defined(_DEBUG) || defined(PTH_VERBOSE_LOG)
+        for (const TypeId typeId : access.getReads())
+        {
+            if (typeId < m_accessStates.size())
+                m_accessStates[typeId].fetch_sub(1, std::memory_order_release);
+        }
+
+        for (const TypeId typeId : access.getWrites())
+        {
+            if (typeId < m_accessStates.size())
+                m_accessStates[typeId].store(0, std::memory_order_release);
+        }
+#endif
+    }
+
+    Tick Scene::getTick() const
+    {
+        return m_tick;
+    }
+
+    Tick Scene::advanceTick()
+    {
+        ++m_tick;
+
+        for (const auto& storage : m_components)
+        {
+            if (storage)
+                storage->setTick(m_tick);
+        }
+
+        return m_tick;
+    }
+
     bool Scene::deserializeStorage(const rapidjson::Value& json)
     {
         if (!CHECK(json.IsObject(), "Unable to deserialize scene component storage - Json value should be an object"))
@@ -250,10 +549,17 @@ namespace PantheonCore::ECS
         if (!CHECK(it != json.MemberEnd(), "Unable to deserialize component storage - Data not found"))
             return false;
 
-        const ComponentRegistry::TypeInfo& typeInfo = ComponentRegistry::getRegisteredTypeInfo(type);
-        IComponentStorage&                 storage  = *(m_components[typeInfo.m_typeId] = typeInfo.makeStorage(this));
+        // Reuse the existing storage if any - groups and listeners reference it
+        const ComponentRegistry::TypeInfo&  typeInfo = ComponentRegistry::getRegisteredTypeInfo(type);
+        std::unique_ptr<IComponentStorage>& storage  = getStorageSlot(typeInfo.m_typeId);
 
-        if (!storage.fromJson(it->value))
+        if (!storage)
+        {
+            storage = typeInfo.makeStorage(this);
+            storage->setTick(m_tick);
+        }
+
+        if (!storage->fromJson(it->value))
             return false;
 
         return true;
@@ -270,14 +576,27 @@ namespace PantheonCore::ECS
         if (!CHECK(offset > 0, "Unable to deserialize component storage type string"))
             return 0;
 
-        const ComponentRegistry::TypeInfo& typeInfo = ComponentRegistry::getRegisteredTypeInfo(typeName);
-        IComponentStorage&                 storage  = *(m_components[typeInfo.m_typeId] = typeInfo.makeStorage(this));
+        // Reuse the existing storage if any - groups and listeners reference it
+        const ComponentRegistry::TypeInfo&  typeInfo = ComponentRegistry::getRegisteredTypeInfo(typeName);
+        std::unique_ptr<IComponentStorage>& storage  = getStorageSlot(typeInfo.m_typeId);
 
-        const size_t readBytes = length >= offset ? storage.fromBinary(data + offset, length - offset) : 0;
+        if (!storage)
+        {
+            storage = typeInfo.makeStorage(this);
+            storage->setTick(m_tick);
+        }
+
+        const size_t readBytes = length >= offset ? storage->fromBinary(data + offset, length - offset) : 0;
 
         if (readBytes == 0)
             return 0;
 
         return offset + readBytes;
     }
+
+    void Scene::refreshObservers()
+    {
+        for (const std::unique_ptr<ISceneObserver>& observer : m_observers)
+            observer->refresh();
+    }
 }
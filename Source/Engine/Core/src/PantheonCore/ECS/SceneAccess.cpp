@@ -0,0 +1,58 @@
+#include "PantheonCore/ECS/SceneAccess.h"
+
+#include <algorithm>
+
+namespace PantheonCore::ECS
+{
+    bool SceneAccess::canRead(const TypeId typeId) const
+    {
+        return std::ranges::binary_search(m_reads, typeId) || canWrite(typeId);
+    }
+
+    bool SceneAccess::canWrite(const TypeId typeId) const
+    {
+        return std::ranges::binary_search(m_writes, typeId);
+    }
+
+    bool SceneAccess::conflictsWith(const SceneAccess& other) const
+    {
+        const auto isWriteReadBy = [](const SceneAccess& writer, const SceneAccess& reader)
+        {
+            return std::ranges::any_of(writer.m_writes, [&reader](const TypeId typeId)
+            {
+                return reader.canRead(typeId);
+            });
+        };
+
+        return isWriteReadBy(*this, other) || isWriteReadBy(other, *this);
+    }
+
+    const std::vector<SceneAccess::TypeId>& SceneAccess::getReads() const
+    {
+        return m_reads;
+    }
+
+    const std::vector<SceneAccess::TypeId>& SceneAccess::getWrites() const
+    {
+        return m_writes;
+    }
+
+    void SceneAccess::addRead(const TypeId typeId)
+    {
+        if (canRead(typeId))
+            return;
+
+        m_reads.insert(std::ranges::upper_bound(m_reads, typeId), typeId);
+    }
+
+    void SceneAccess::addWrite(const TypeId typeId)
+    {
+        if (canWrite(typeId))
+            return;
+
+        if (const auto it = std::ranges::lower_bound(m_reads, typeId); it != m_reads.end() && *it == typeId)
+            m_reads.erase(it);
+
+        m_writes.insert(std::ranges::upper_bound(m_writes, typeId), typeId);
+    }
+}
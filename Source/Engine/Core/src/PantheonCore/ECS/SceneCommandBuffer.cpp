@@ -0,0 +1,77 @@
+#include "PantheonCore/ECS/SceneCommandBuffer.h"
+
+#include "PantheonCore/ECS/EntityHandle.h"
+
+namespace PantheonCore::ECS
+{
+    Entity SceneCommandBuffer::create()
+    {
+        ASSERT(m_pendingCount < Entity::INDEX_MASK, "Unable to record entity creation - Too many pending entities");
+        return { m_pendingCount++, PENDING_VERSION };
+    }
+
+    void SceneCommandBuffer::destroy(const Entity entity)
+    {
+        m_destroyed.push_back(entity);
+    }
+
+    void SceneCommandBuffer::flush(Scene& scene)
+    {
+        m_created.clear();
+        m_created.reserve(m_pendingCount);
+
+        for (Entity::Id i = 0; i < m_pendingCount; ++i)
+            m_created.push_back(scene.create().getEntity());
+
+        for (const std::unique_ptr<ICommandQueue>& queue : m_queues)
+        {
+            if (queue && !queue->empty())
+                queue->flush(scene, m_created);
+        }
+
+        for (const Entity entity : m_destroyed)
+            scene.destroy(resolve(entity, m_created));
+
+        m_destroyed.clear();
+        m_pendingCount = 0;
+    }
+
+    void SceneCommandBuffer::clear()
+    {
+        for (const std::unique_ptr<ICommandQueue>& queue : m_queues)
+        {
+            if (queue)
+                queue->clear();
+        }
+
+        m_destroyed.clear();
+        m_pendingCount = 0;
+    }
+
+    bool SceneCommandBuffer::empty() const
+    {
+        if (m_pendingCount != 0 || !m_destroyed.empty())
+            return false;
+
+        for (const std::unique_ptr<ICommandQueue>& queue : m_queues)
+        {
+            if (queue && !queue->empty())
+                return false;
+        }
+
+        return true;
+    }
+
+    bool SceneCommandBuffer::isPending(const Entity entity)
+    {
+        return entity.getVersion() == PENDING_VERSION && entity.getIndex() != Entity::INDEX_MASK;
+    }
+
+    Entity SceneCommandBuffer::resolve(const Entity entity, const std::vector<Entity>& created)
+    {
+        if (!isPending(entity))
+            return entity;
+
+        return entity.getIndex() < created.size() ? created[entity.getIndex()] : NULL_ENTITY;
+    }
+}
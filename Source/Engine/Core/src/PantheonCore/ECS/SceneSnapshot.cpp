@@ -0,0 +1,146 @@
+#include "PantheonCore/ECS/SceneSnapshot.h"
+
+#include <algorithm>
+
+namespace PantheonCore::ECS
+{
+    SceneSnapshot::Reader::Reader(const SceneSnapshot& snapshot)
+        : m_snapshot(&snapshot), m_block(0)
+    {
+    }
+
+    SceneSnapshot::SceneSnapshot(const size_t capacity)
+    {
+        reserve(capacity);
+    }
+
+    SceneSnapshot::SceneSnapshot(SceneSnapshot&& other) noexcept
+        : m_pages(std::move(other.m_pages)), m_blocks(std::move(other.m_blocks)), m_page(other.m_page), m_offset(other.m_offset),
+        m_size(other.m_size), m_capacity(other.m_capacity)
+    {
+        other.m_blocks.clear();
+        other.m_pages.clear();
+        other.m_page     = 0;
+        other.m_offset   = 0;
+        other.m_size     = 0;
+        other.m_capacity = 0;
+    }
+
+    SceneSnapshot::~SceneSnapshot()
+    {
+        clear();
+    }
+
+    SceneSnapshot& SceneSnapshot::operator=(SceneSnapshot&& other) noexcept
+    {
+        if (&other == this)
+            return *this;
+
+        clear();
+
+        m_pages    = std::move(other.m_pages);
+        m_blocks   = std::move(other.m_blocks);
+        m_page     = other.m_page;
+        m_offset   = other.m_offset;
+        m_size     = other.m_size;
+        m_capacity = other.m_capacity;
+
+        other.m_blocks.clear();
+        other.m_pages.clear();
+        other.m_page     = 0;
+        other.m_offset   = 0;
+        other.m_size     = 0;
+        other.m_capacity = 0;
+
+        return *this;
+    }
+
+    void SceneSnapshot::clear()
+    {
+        for (const Block& block : m_blocks)
+        {
+            if (block.m_destroy)
+                block.m_destroy(block.m_data, block.m_count);
+        }
+
+        m_blocks.clear();
+
+        // Merge the pages added by the previous capture so the next ones fit in a single preallocated page
+        if (m_pages.size() > 1)
+        {
+            const size_t capacity = m_capacity;
+
+            m_pages.clear();
+            m_capacity = 0;
+
+            reserve(capacity);
+        }
+
+        m_page   = 0;
+        m_offset = 0;
+        m_size   = 0;
+    }
+
+    void SceneSnapshot::reserve(const size_t capacity)
+    {
+        if (capacity <= m_capacity)
+            return;
+
+        // Pages can't be reallocated while they hold copies - only replace them when the snapshot is empty
+        if (m_blocks.empty())
+        {
+            m_pages.clear();
+            m_capacity = 0;
+            m_page     = 0;
+            m_offset   = 0;
+        }
+
+        const size_t pageSize = capacity - m_capacity;
+
+        m_pages.push_back({ std::make_unique_for_overwrite<std::byte[]>(pageSize), pageSize });
+        m_capacity = capacity;
+    }
+
+    bool SceneSnapshot::empty() const
+    {
+        return m_blocks.empty();
+    }
+
+    size_t SceneSnapshot::getSize() const
+    {
+        return m_size;
+    }
+
+    size_t SceneSnapshot::getCapacity() const
+    {
+        return m_capacity;
+    }
+
+    std::byte* SceneSnapshot::allocate(const size_t size, const size_t alignment)
+    {
+        for (; m_page < m_pages.size(); ++m_page, m_offset = 0)
+        {
+            const Page&  page   = m_pages[m_page];
+            const size_t offset = (m_offset + alignment - 1) / alignment * alignment;
+
+            if (offset + size <= page.m_size)
+            {
+                m_offset = offset + size;
+                m_size += size;
+
+                return page.m_data.get() + offset;
+            }
+        }
+
+        // Grow geometrically to limit the number of pages of the first captures
+        const size_t pageSize = std::max({ size, m_capacity, MIN_PAGE_SIZE });
+
+        m_pages.push_back({ std::make_unique_for_overwrite<std::byte[]>(pageSize), pageSize });
+        m_capacity += pageSize;
+        m_page   = m_pages.size() - 1;
+        m_offset = size;
+        m_size += size;
+
+        return m_pages.back().m_data.get();
+    }
+}
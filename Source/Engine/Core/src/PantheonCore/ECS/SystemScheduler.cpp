@@ -0,0 +1,169 @@
+#include "PantheonCore/ECS/SystemScheduler.h"
+
+#include "PantheonCore/Debug/Assertion.h"
+#include "PantheonCore/ECS/Scene.h"
+#include "PantheonCore/Utility/ThreadPool.h"
+
+#include <chrono>
+
+namespace PantheonCore::ECS
+{
+    namespace
+    {
+        using clock = std::chrono::steady_clock;
+    }
+
+    ISystem& SystemScheduler::getSystem(const SystemId id)
+    {
+        ASSERT(id < m_systems.size(), "Unable to get system %llu - Out of range", id);
+        return *m_systems[id].m_system;
+    }
+
+    size_t SystemScheduler::getSystemCount() const
+    {
+        return m_systems.size();
+    }
+
+    const std::vector<SystemScheduler::SystemId>& SystemScheduler::getDependencies(const SystemId id) const
+    {
+        ASSERT(id < m_systems.size(), "Unable to get system %llu's dependencies - Out of range", id);
+        return m_systems[id].m_dependencies;
+    }
+
+    float SystemScheduler::getUpdateTime(const SystemId id) const
+    {
+        ASSERT(id < m_systems.size(), "Unable to get system %llu's update time - Out of range", id);
+        return m_systems[id].m_updateTime;
+    }
+
+    float SystemScheduler::getFrameTime() const
+    {
+        return m_frameTime;
+    }
+
+    void SystemScheduler::update(Scene& scene, const float deltaTime)
+    {
+        const clock::time_point start = clock::now();
+
+        scene.freeze();
+
+        // Dependencies always point to previously added systems - the registration order is a valid execution order
+        for (SystemNode& node : m_systems)
+            runSystem(node, scene, deltaTime);
+
+        scene.unfreeze();
+        scene.advanceTick();
+
+        m_frameTime = std::chrono::duration<float>(clock::now() - start).count();
+    }
+
+    void SystemScheduler::update(Scene& scene, const float deltaTime, Utility::ThreadPool& threadPool)
+    {
+        if (threadPool.getWorkersCount() == 0 || m_systems.size() < 2)
+        {
+            update(scene, deltaTime);
+            return;
+        }
+
+        const clock::time_point start = clock::now();
+
+        if (m_pendingCounts.size() != m_systems.size())
+            m_pendingCounts = std::vector<std::atomic<uint32_t>>(m_systems.size());
+
+        for (size_t i = 0; i < m_systems.size(); ++i)
+            m_pendingCounts[i].store(static_cast<uint32_t>(m_systems[i].m_dependencies.size()), std::memory_order_relaxed);
+
+        scene.freeze();
+
+        for (SystemId id = 0; id < m_systems.size(); ++id)
+        {
+            if (m_systems[id].m_dependencies.empty())
+                schedule(id, scene, deltaTime, threadPool);
+        }
+
+        // Help instead of blocking - a system waiting on nested tasks could otherwise hold the last worker
+        threadPool.wait(m_counter);
+
+        scene.unfreeze();
+        scene.advanceTick();
+
+        m_frameTime = std::chrono::duration<float>(clock::now() - start).count();
+    }
+
+    void SystemScheduler::clear()
+    {
+        m_systems.clear();
+        m_pendingCounts.clear();
+        m_frameTime = 0.f;
+    }
+
+    void SystemScheduler::addNode(std::unique_ptr<ISystem> system)
+    {
+        const SystemId id = m_systems.size();
+
+        SystemNode& node = m_systems.emplace_back();
+        node.m_access    = system->getAccess();
+        node.m_system    = std::move(system);
+
+        for (SystemId i = 0; i < id; ++i)
+        {
+            if (m_systems[i].m_access.conflictsWith(node.m_access))
+            {
+                node.m_dependencies.push_back(i);
+                m_systems[i].m_dependents.push_back(id);
+            }
+        }
+    }
+
+    void SystemScheduler::runSystem(SystemNode& node, Scene& scene, const float deltaTime)
+    {
+        const clock::time_point start = clock::now();
+
+        scene.beginAccess(node.m_access);
+        node.m_system->update(scene, deltaTime);
+        scene.endAccess(node.m_access);
+
+        node.m_updateTime = std::chrono::duration<float>(clock::now() - start).count();
+    }
+
+    void SystemScheduler::schedule(const SystemId id, Scene& scene, const float deltaTime, Utility::ThreadPool& threadPool)
+    {
+        threadPool.submit([this, id, &scene, deltaTime, &threadPool]
+        {
+            execute(id, scene, deltaTime, threadPool);
+        }, m_counter);
+    }
+
+    void SystemScheduler::execute(SystemId id, Scene& scene, const float deltaTime, Utility::ThreadPool& threadPool)
+    {
+        while (true)
+        {
+            SystemNode& node = m_systems[id];
+            runSystem(node, scene, deltaTime);
+
+            bool     hasNext = false;
+            SystemId next    = 0;
+
+            for (const SystemId dependent : node.m_dependents)
+            {
+                if (m_pendingCounts[dependent].fetch_sub(1, std::memory_order_acq_rel) != 1)
+                    continue;
+
+                if (!hasNext)
+                {
+                    hasNext = true;
+                    next    = dependent;
+                    continue;
+                }
+
+                schedule(dependent, scene, deltaTime, threadPool);
+            }
+
+            // Continuations run within the submitted task, which keeps the counter pending until the chain ends
+            if (!hasNext)
+                return;
+
+            id = next;
+        }
+    }
+}
@@ -0,0 +1,348 @@
+#include "PantheonCore/ECS/Systems/TransformSystem.h"
+
+#include "PantheonCore/ECS/Scene.h"
+#include "PantheonCore/ECS/Components/Hierarchy.h"
+#include "PantheonCore/Utility/ThreadPool.h"
+
+#include <algorithm>
+
+using namespace LibMath;
+
+namespace PantheonCore::ECS
+{
+    TransformSystem::TransformSystem(Scene& scene, Utility::ThreadPool* threadPool)
+        : m_scene(&scene), m_threadPool(threadPool), m_lastTick(0), m_updatedCount(0), m_isStructureDirty(true)
+    {
+        scene.registerStorages<Transform, HierarchyComponent>();
+
+        ComponentStorage<HierarchyComponent>& hierarchies = scene.getStorage<HierarchyComponent>();
+        ComponentStorage<Transform>&          transforms  = scene.getStorage<Transform>();
+
+        transforms.setChangeTracking(true);
+
+        const auto onStructureChange = [this](EntityHandle, auto&)
+        {
+            m_isStructureDirty = true;
+        };
+
+        m_hierarchyAddListener    = hierarchies.m_onAdd.subscribe(onStructureChange);
+        m_hierarchyRemoveListener = hierarchies.m_onRemove.subscribe(onStructureChange);
+        m_hierarchyChangeListener = hierarchies.m_onChange.subscribe(onStructureChange);
+        m_transformAddListener    = transforms.m_onAdd.subscribe(onStructureChange);
+        m_transformRemoveListener = transforms.m_onRemove.subscribe(onStructureChange);
+    }
+
+    TransformSystem::~TransformSystem()
+    {
+        ComponentStorage<HierarchyComponent>& hierarchies = m_scene->getStorage<HierarchyComponent>();
+        ComponentStorage<Transform>&          transforms  = m_scene->getStorage<Transform>();
+
+        hierarchies.m_onAdd.unsubscribe(m_hierarchyAddListener);
+        hierarchies.m_onRemove.unsubscribe(m_hierarchyRemoveListener);
+        hierarchies.m_onChange.unsubscribe(m_hierarchyChangeListener);
+        transforms.m_onAdd.unsubscribe(m_transformAddListener);
+        transforms.m_onRemove.unsubscribe(m_transformRemoveListener);
+    }
+
+    SceneAccess TransformSystem::getAccess() const
+    {
+        return SceneAccess().read<Transform, HierarchyComponent>();
+    }
+
+    void TransformSystem::update(Scene& scene, float)
+    {
+        ASSERT(&scene == m_scene, "Unable to update transform system - The scene isn't the system's scene");
+
+        if (m_isStructureDirty)
+            rebuild();
+        else
+            gatherChanges();
+
+        propagate();
+
+        m_lastTick = scene.getTick();
+    }
+
+    void TransformSystem::invalidate()
+    {
+        m_isStructureDirty = true;
+    }
+
+    void TransformSystem::setThreadPool(Utility::ThreadPool* threadPool)
+    {
+        m_threadPool = threadPool;
+        buildPartitions();
+    }
+
+    size_t TransformSystem::getPartitionCount() const
+    {
+        return m_partitions.empty() ? 0 : m_partitions.size() - 1;
+    }
+
+    const Matrix4* TransformSystem::findWorldMatrix(const Entity entity) const
+    {
+        const Index index = find(entity);
+        return index != INVALID_INDEX ? &m_worldMatrices[index] : nullptr;
+    }
+
+    TransformSystem::Index TransformSystem::find(const Entity entity) const
+    {
+        const Entity::Id entityIndex = entity.getIndex();
+
+        if (entityIndex >= m_lookup.size())
+            return INVALID_INDEX;
+
+        const Index index = m_lookup[entityIndex];
+        return index < m_nodes.size() && m_nodes[index].m_entity == entity ? index : INVALID_INDEX;
+    }
+
+    size_t TransformSystem::getCount() const
+    {
+        return m_nodes.size();
+    }
+
+    size_t TransformSystem::getUpdatedCount() const
+    {
+        return m_updatedCount;
+    }
+
+    void TransformSystem::rebuild()
+    {
+        const ComponentStorage<HierarchyComponent>& hierarchies = m_scene->getStorage<HierarchyComponent>();
+        const ComponentStorage<Transform>&          transforms  = m_scene->getStorage<Transform>();
+
+        // Stale lookup entries are rejected by find's entity check - no need to reset them
+        m_nodes.clear();
+        m_nodes.reserve(transforms.getCount());
+
+        for (const Entity owner : transforms.getOwners())
+        {
+            if (!hierarchies.has(owner))
+                addSubtree(owner);
+        }
+
+        for (Index i = 0; i < hierarchies.getCount(); ++i)
+        {
+            const Entity owner = hierarchies.getOwners()[i];
+
+            if (hierarchies.find(owner)->getParent() == NULL_ENTITY)
+                addSubtree(owner);
+        }
+
+        // Subtrees are contiguous and children always come after their parent - accumulate sizes from the back
+        for (Index i = m_nodes.size(); i-- > 0;)
+        {
+            if (m_nodes[i].m_parent != INVALID_INDEX)
+                m_nodes[m_nodes[i].m_parent].m_subtreeSize += m_nodes[i].m_subtreeSize;
+        }
+
+        m_worldMatrices.resize(m_nodes.size());
+        m_dirtyFlags.assign(m_nodes.size(), 1);
+        m_isStructureDirty = false;
+
+        buildPartitions();
+    }
+
+    void TransformSystem::addSubtree(const Entity root)
+    {
+        const ComponentStorage<HierarchyComponent>& hierarchies = m_scene->getStorage<HierarchyComponent>();
+        const ComponentStorage<Transform>&          transforms  = m_scene->getStorage<Transform>();
+
+        // Pending entries only use the entity and the index of its closest transform ancestor
+        m_pending.push_back({ root, INVALID_INDEX, 0 });
+
+        while (!m_pending.empty())
+        {
+            const Node entry = m_pending.back();
+            m_pending.pop_back();
+
+            Index parent = entry.m_parent;
+
+            if (transforms.has(entry.m_entity))
+            {
+                parent = m_nodes.size();
+                m_nodes.push_back({ entry.m_entity, entry.m_parent, 1 });
+
+                const Entity::Id entityIndex = entry.m_entity.getIndex();
+
+                if (entityIndex >= m_lookup.size())
+                    m_lookup.resize(entityIndex + 1, INVALID_INDEX);
+
+                m_lookup[entityIndex] = parent;
+            }
+
+            const HierarchyComponent* hierarchy = hierarchies.find(entry.m_entity);
+            Entity                    child     = hierarchy ? hierarchy->getFirstChild() : NULL_ENTITY;
+
+            while (child != NULL_ENTITY)
+            {
+                m_pending.push_back({ child, parent, 0 });
+
+                const HierarchyComponent* childHierarchy = hierarchies.find(child);
+                child = childHierarchy ? childHierarchy->getNextSibling() : NULL_ENTITY;
+            }
+        }
+    }
+
+    void TransformSystem::gatherChanges()
+    {
+        const ComponentStorage<Transform>& transforms = m_scene->getStorage<Transform>();
+
+        if (transforms.getCount() != m_nodes.size())
+        {
+            rebuild();
+            return;
+        }
+
+        // Changes stamped with the last update's tick were processed by it - the tick is advanced once per frame after the update
+        for (Index i = 0; i < transforms.getCount(); ++i)
+        {
+            if (transforms.getChangeTick(i) <= m_lastTick)
+                continue;
+
+            const Index index = find(transforms.getOwners()[i]);
+
+            if (index == INVALID_INDEX)
+            {
+                rebuild();
+                return;
+            }
+
+            m_dirtyFlags[index] = 1;
+        }
+    }
+
+    void TransformSystem::buildPartitions()
+    {
+        m_partitions.clear();
+        m_partitions.push_back(0);
+
+        const size_t threadCount = m_threadPool ? m_threadPool->getWorkersCount() + 1 : 1;
+
+        if (threadCount < 2)
+        {
+            m_partitions.push_back(m_nodes.size());
+            return;
+        }
+
+        // Split the root subtrees into a few contiguous batches per thread to keep the load balanced
+        const Index targetSize = std::max(MIN_PARTITION_SIZE, m_nodes.size() / (threadCount * PARTITIONS_PER_THREAD));
+        Index       batchSize  = 0;
+
+        for (Index root = 0; root < m_nodes.size(); root += m_nodes[root].m_subtreeSize)
+        {
+            batchSize += m_nodes[root].m_subtreeSize;
+
+            if (batchSize >= targetSize)
+            {
+                m_partitions.push_back(root + m_nodes[root].m_subtreeSize);
+                batchSize = 0;
+            }
+        }
+
+        if (m_partitions.back() != m_nodes.size())
+            m_partitions.push_back(m_nodes.size());
+    }
+
+    void TransformSystem::propagate()
+    {
+        const ComponentStorage<Transform>& transforms     = m_scene->getStorage<Transform>();
+        const size_t                       partitionCount = m_partitions.size() - 1;
+
+        if (!m_threadPool || m_threadPool->getWorkersCount() == 0 || partitionCount < 2)
+        {
+            bool hasMissingTransforms = false;
+
+            m_updatedCount = propagate(transforms, 0, m_nodes.size(), hasMissingTransforms);
+            m_isStructureDirty |= hasMissingTransforms;
+            return;
+        }
+
+        PropagationJob& job = m_job;
+
+        job.m_system               = this;
+        job.m_transforms           = &transforms;
+        job.m_partitionCount       = partitionCount;
+        job.m_nextPartition        = 0;
+        job.m_updatedCount         = 0;
+        job.m_hasMissingTransforms = false;
+
+        const size_t taskCount = std::min<size_t>(m_threadPool->getWorkersCount(), partitionCount - 1);
+
+        for (size_t i = 0; i < taskCount; ++i)
+        {
+            m_threadPool->submit([&job]
+            {
+                job.run();
+            }, job.m_counter);
+        }
+
+        // Process partitions on the calling thread too, then help with the pool's tasks until the workers are done
+        job.run();
+        m_threadPool->wait(job.m_counter);
+
+        m_updatedCount = job.m_updatedCount.load(std::memory_order_relaxed);
+        m_isStructureDirty |= job.m_hasMissingTransforms.load(std::memory_order_relaxed);
+    }
+
+    size_t TransformSystem::propagate(const ComponentStorage<Transform>& transforms, Index begin, const Index end,
+                                      bool& hasMissingTransforms)
+    {
+        size_t updatedCount = 0;
+
+        while (begin < end)
+        {
+            if (!m_dirtyFlags[begin])
+            {
+                ++begin;
+                continue;
+            }
+
+            // A dirty node invalidates its whole subtree, which is stored right after it
+            const Index subtreeEnd = begin + m_nodes[begin].m_subtreeSize;
+            updatedCount += m_nodes[begin].m_subtreeSize;
+
+            for (; begin < subtreeEnd; ++begin)
+            {
+                const Node&      node      = m_nodes[begin];
+                const Transform* transform = transforms.find(node.m_entity);
+
+                m_dirtyFlags[begin] = 0;
+
+                if (!transform)
+                {
+                    hasMissingTransforms = true;
+                    continue;
+                }
+
+                m_worldMatrices[begin] = node.m_parent != INVALID_INDEX
+                                             ? m_worldMatrices[node.m_parent] * transform->getMatrix()
+                                             : transform->getMatrix();
+            }
+        }
+
+        return updatedCount;
+    }
+
+    void TransformSystem::PropagationJob::run()
+    {
+        while (true)
+        {
+            const size_t partition = m_nextPartition.fetch_add(1, std::memory_order_relaxed);
+
+            if (partition >= m_partitionCount)
+                return;
+
+            const std::vector<Index>& partitions           = m_system->m_partitions;
+            bool                      hasMissingTransforms = false;
+
+            const size_t updatedCount = m_system->propagate(*m_transforms, partitions[partition], partitions[partition + 1],
+                hasMissingTransforms);
+
+            m_updatedCount.fetch_add(updatedCount, std::memory_order_relaxed);
+
+            if (hasMissingTransforms)
+                m_hasMissingTransforms.store(true, std::memory_order_relaxed);
+        }
+    }
+}
@@ -0,0 +1,114 @@
+#include "PantheonCore/Utility/PoolAllocator.h"
+
+#include "PantheonCore/Debug/Assertion.h"
+
+#include <algorithm>
+
+namespace PantheonCore::Utility
+{
+    PoolAllocator::PoolAllocator(const size_t blockSize, const size_t blocksPerPage)
+        : m_sharedList(nullptr), m_sharedCount(0), m_blocksPerPage(std::max<size_t>(blocksPerPage, 1))
+    {
+        constexpr size_t alignment = alignof(std::max_align_t);
+        m_blockSize                = (std::max(blockSize, sizeof(Block)) + alignment - 1) / alignment * alignment;
+    }
+
+    void* PoolAllocator::allocate(Cache& cache)
+    {
+        if (!cache.m_freeList)
+            refill(cache);
+
+        Block* block     = cache.m_freeList;
+        cache.m_freeList = block->m_next;
+        --cache.m_freeCount;
+
+        return block;
+    }
+
+    void PoolAllocator::deallocate(Cache& cache, void* block)
+    {
+        ASSERT(block != nullptr);
+
+        Block* freed     = static_cast<Block*>(block);
+        freed->m_next    = cache.m_freeList;
+        cache.m_freeList = freed;
+        ++cache.m_freeCount;
+
+        // Threads that mostly free blocks (e.g. consumers) hand a batch back to the threads that mostly allocate them
+        if (cache.m_freeCount < 2 * m_blocksPerPage)
+            return;
+
+        Block* first = cache.m_freeList;
+        Block* last  = first;
+
+        for (size_t i = 1; i < m_blocksPerPage; ++i)
+            last = last->m_next;
+
+        cache.m_freeList = last->m_next;
+        cache.m_freeCount -= m_blocksPerPage;
+
+        std::lock_guard lock(m_mutex);
+
+        last->m_next = m_sharedList;
+        m_sharedList = first;
+        m_sharedCount += m_blocksPerPage;
+    }
+
+    void PoolAllocator::release(Cache& cache)
+    {
+        if (!cache.m_freeList)
+            return;
+
+        Block* last = cache.m_freeList;
+
+        while (last->m_next)
+            last = last->m_next;
+
+        std::lock_guard lock(m_mutex);
+
+        last->m_next = m_sharedList;
+        m_sharedList = cache.m_freeList;
+        m_sharedCount += cache.m_freeCount;
+
+        cache.m_freeList  = nullptr;
+        cache.m_freeCount = 0;
+    }
+
+    size_t PoolAllocator::getBlockSize() const
+    {
+        return m_blockSize;
+    }
+
+    void PoolAllocator::refill(Cache& cache)
+    {
+        std::lock_guard lock(m_mutex);
+
+        if (m_sharedList)
+        {
+            const size_t count = std::min(m_sharedCount, m_blocksPerPage);
+            Block*       last  = m_sharedList;
+
+            for (size_t i = 1; i < count; ++i)
+                last = last->m_next;
+
+            cache.m_freeList  = m_sharedList;
+            cache.m_freeCount = count;
+
+            m_sharedList = last->m_next;
+            m_sharedCount -= count;
+            last->m_next = nullptr;
+
+            return;
+        }
+
+        std::byte* page = m_pages.emplace_back(std::make_unique_for_overwrite<std::byte[]>(m_blockSize * m_blocksPerPage)).get();
+
+        for (size_t i = m_blocksPerPage; i-- > 0;)
+        {
+            Block* block     = new(page + i * m_blockSize) Block{ cache.m_freeList };
+            cache.m_freeList = block;
+        }
+
+        cache.m_freeCount = m_blocksPerPage;
+    }
+}
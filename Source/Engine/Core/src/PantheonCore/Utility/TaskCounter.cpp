@@ -0,0 +1,30 @@
+#include "PantheonCore/Utility/TaskCounter.h"
+
+#include "PantheonCore/Debug/Assertion.h"
+
+namespace PantheonCore::Utility
+{
+    void TaskCounter::increment(const size_t count)
+    {
+        m_count.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    bool TaskCounter::decrement()
+    {
+        // Release the task's side effects to the threads observing the counter's completion
+        const size_t previous = m_count.fetch_sub(1, std::memory_order_acq_rel);
+        ASSERT(previous > 0, "Unable to decrement task counter - No task is pending");
+
+        return previous == 1;
+    }
+
+    bool TaskCounter::isDone() const
+    {
+        return m_count.load(std::memory_order_acquire) == 0;
+    }
+
+    size_t TaskCounter::getCount() const
+    {
+        return m_count.load(std::memory_order_acquire);
+    }
+}
@@ -0,0 +1,130 @@
+#include "PantheonCore/Utility/TaskGraph.h"
+
+#include "PantheonCore/Utility/ThreadPool.h"
+#include "PantheonCore/Utility/utility.h"
+
+namespace PantheonCore::Utility
+{
+    void TaskGraph::addDependency(const NodeId node, const NodeId predecessor)
+    {
+        ASSERT(m_counter.isDone(), "Unable to add task graph dependency - The graph is running");
+        ASSERT(node < m_nodes.size() && predecessor < m_nodes.size(), "Unable to add task graph dependency - Invalid node id");
+        ASSERT(node != predecessor, "Unable to add task graph dependency - A node can't depend on itself");
+
+        m_nodes[predecessor]->m_successors.push_back(m_nodes[node].get());
+        ++m_nodes[node]->m_predecessorsCount;
+    }
+
+    void TaskGraph::run(ThreadPool& threadPool)
+    {
+        ASSERT(m_counter.isDone(), "Unable to run task graph - The graph is already running");
+
+        m_startTime = Clock::now();
+
+        for (const auto& node : m_nodes)
+        {
+            node->m_pendingCount.store(node->m_predecessorsCount, std::memory_order_relaxed);
+            node->m_timing = {};
+        }
+
+        bool hasRoot = false;
+
+        for (const auto& node : m_nodes)
+        {
+            if (node->m_predecessorsCount == 0)
+            {
+                schedule(threadPool, *node);
+                hasRoot = true;
+            }
+        }
+
+        ASSERT(hasRoot || m_nodes.empty(), "Unable to run task graph - The graph has no root node");
+
+        threadPool.wait(m_counter);
+
+        m_duration = getElapsedTime();
+    }
+
+    void TaskGraph::clear()
+    {
+        ASSERT(m_counter.isDone(), "Unable to clear task graph - The graph is running");
+
+        m_nodes.clear();
+        m_duration = 0;
+    }
+
+    size_t TaskGraph::getNodeCount() const
+    {
+        return m_nodes.size();
+    }
+
+    const std::string& TaskGraph::getName(const NodeId node) const
+    {
+        ASSERT(node < m_nodes.size(), "Unable to get task graph node name - Invalid node id");
+        return m_nodes[node]->m_name;
+    }
+
+    TaskGraph::NodeTiming TaskGraph::getTiming(const NodeId node) const
+    {
+        ASSERT(node < m_nodes.size(), "Unable to get task graph node timing - Invalid node id");
+        return m_nodes[node]->m_timing;
+    }
+
+    double TaskGraph::getDuration() const
+    {
+        return m_duration;
+    }
+
+    std::string TaskGraph::dumpTimings() const
+    {
+        std::string dump = formatString("Task graph - %llu node(s) in %.3fms\n", m_nodes.size(), m_duration);
+
+        for (const auto& node : m_nodes)
+        {
+            dump += formatString("  %-32s start %9.3fms | duration %9.3fms\n", node->m_name.c_str(),
+                node->m_timing.m_start, node->m_timing.m_duration);
+        }
+
+        return dump;
+    }
+
+    void TaskGraph::schedule(ThreadPool& threadPool, Node& node)
+    {
+        threadPool.submit([this, &threadPool, &node]
+        {
+            execute(threadPool, &node);
+        }, m_counter);
+    }
+
+    void TaskGraph::execute(ThreadPool& threadPool, Node* node)
+    {
+        // Continuations run within the submitted task, which keeps the graph's counter pending until the chain ends
+        while (node != nullptr)
+        {
+            const double start = getElapsedTime();
+            node->m_task();
+            node->m_timing = { start, getElapsedTime() - start };
+
+            Node* next = nullptr;
+
+            for (Node* successor : node->m_successors)
+            {
+                // Acquire the other predecessors' side effects along with the last decrement
+                if (successor->m_pendingCount.fetch_sub(1, std::memory_order_acq_rel) != 1)
+                    continue;
+
+                if (next == nullptr)
+                    next = successor;
+                else
+                    schedule(threadPool, *successor);
+            }
+
+            node = next;
+        }
+    }
+
+    double TaskGraph::getElapsedTime() const
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - m_startTime).count();
+    }
+}
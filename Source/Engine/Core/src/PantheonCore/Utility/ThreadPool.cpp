@@ -1,14 +1,32 @@
 ﻿#include "PantheonCore/Utility/ThreadPool.h"
 
+#include "PantheonCore/Debug/Assertion.h"
+
 namespace PantheonCore::Utility
 {
+    namespace
+    {
+        uint32_t nextRandom(uint32_t& state)
+        {
+            // xorshift32
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+
+            return state;
+        }
+    }
+
+    thread_local ThreadPool::Worker* ThreadPool::s_localWorker = nullptr;
+
     ThreadPool::ThreadPool()
         : ThreadPool(std::thread::hardware_concurrency() - 1)
     {
     }
 
     ThreadPool::ThreadPool(const unsigned workersCount)
-        : m_workersCount(workersCount), m_activeWorkersCount(0), m_isRunning(false), m_shouldTerminate(false)
+        : m_taskAllocator(sizeof(QueuedTask)), m_queueSize(0), m_pendingCount(0), m_unfinishedCount(0), m_activeWorkersCount(0), m_sleepingCount(0),
+        m_waitingCount(0), m_workersCount(workersCount), m_isRunning(false), m_shouldTerminate(false)
     {
         start();
     }
@@ -23,20 +41,56 @@ namespace PantheonCore::Utility
         if (m_isRunning)
             return;
 
-        m_threads.reserve(m_workersCount);
+        m_shouldTerminate = false;
+        m_workers.reserve(m_workersCount);
 
         for (unsigned i = 0; i < m_workersCount; ++i)
-            m_threads.emplace_back(&ThreadPool::workerLoop, this);
+        {
+            Worker& worker = *m_workers.emplace_back(std::make_unique<Worker>());
+            worker.m_pool  = this;
+            worker.m_seed  = 0x9E3779B9u * (i + 1);
+        }
+
+        // Start the threads once every deque exists - workers steal from each other right away
+        for (const std::unique_ptr<Worker>& worker : m_workers)
+            worker->m_thread = std::thread(&ThreadPool::workerLoop, this, std::ref(*worker));
 
         m_isRunning = true;
     }
 
-    bool ThreadPool::isBusy() const
+    bool ThreadPool::runPendingTask()
     {
+        Worker*     worker = getLocalWorker();
+        QueuedTask* task   = findTask(worker);
+
+        if (!task)
+            return false;
+
+        execute(task, worker);
+        return true;
+    }
+
+    void ThreadPool::wait(const TaskCounter& counter)
+    {
+        helpUntil([&counter]
         {
-            std::lock_guard lock(m_tasksMutex);
-            return !m_tasks.empty() || m_activeWorkersCount > 0;
-        }
+            return counter.isDone();
+        });
+    }
+
+    void ThreadPool::waitIdle()
+    {
+        ASSERT(getLocalWorker() == nullptr, "Unable to wait for thread pool - Called from one of the pool's tasks");
+
+        helpUntil([this]
+        {
+            return !isBusy();
+        });
+    }
+
+    bool ThreadPool::isBusy() const
+    {
+        return m_unfinishedCount.load(std::memory_order_acquire) > 0;
     }
 
     void ThreadPool::stop()
@@ -45,17 +99,34 @@ namespace PantheonCore::Utility
             return;
 
         {
-            std::lock_guard lock(m_tasksMutex);
+            std::lock_guard lock(m_sleepMutex);
             m_shouldTerminate = true;
         }
 
-        m_mutexCondition.notify_all();
+        m_sleepCondition.notify_all();
 
-        for (std::thread& thread : m_threads)
-            thread.join();
+        for (const std::unique_ptr<Worker>& worker : m_workers)
+            worker->m_thread.join();
 
-        m_threads.clear();
-        m_isRunning = false;
+        // Tasks that haven't been started are dropped - their counters are left as is
+        for (const std::unique_ptr<Worker>& worker : m_workers)
+        {
+            QueuedTask* task;
+
+            while (worker->m_tasks.pop(task))
+                destroyTask(task, worker.get());
+
+            m_taskAllocator.release(worker->m_taskCache);
+        }
+
+        for (; !m_queue.empty(); m_queue.pop_front())
+            destroyTask(m_queue.front(), nullptr);
+
+        m_workers.clear();
+        m_queueSize       = 0;
+        m_pendingCount    = 0;
+        m_unfinishedCount = 0;
+        m_isRunning       = false;
     }
 
     unsigned ThreadPool::getWorkersCount() const
@@ -65,38 +136,193 @@ namespace PantheonCore::Utility
 
     unsigned ThreadPool::getActiveCount() const
     {
-        std::lock_guard lock(m_tasksMutex);
-        return m_activeWorkersCount;
+        return m_activeWorkersCount.load();
+    }
+
+    void* ThreadPool::allocateTask(Worker* worker)
+    {
+        if (worker)
+            return m_taskAllocator.allocate(worker->m_taskCache);
+
+        std::lock_guard lock(m_queueMutex);
+        return m_taskAllocator.allocate(m_externalCache);
+    }
+
+    void ThreadPool::push(QueuedTask* task, Worker* worker)
+    {
+        // Count the task before publishing it - a thief may take it right away
+        ++m_unfinishedCount;
+        ++m_pendingCount;
+
+        if (worker)
+        {
+            worker->m_tasks.push(task);
+        }
+        else
+        {
+            std::lock_guard lock(m_queueMutex);
+            m_queue.push_back(task);
+            ++m_queueSize;
+        }
+
+        // Sleeping threads register themselves before checking the pending count, so either they see the new task
+        // or this sees them. Locking makes sure the notification can't happen between their check and their wait
+        const bool hasSleepingWorkers = m_sleepingCount.load() > 0;
+        const bool hasWaitingThreads  = m_waitingCount.load() > 0;
+
+        if (hasSleepingWorkers || hasWaitingThreads)
+        {
+            {
+                std::lock_guard lock(m_sleepMutex);
+            }
+
+            if (hasSleepingWorkers)
+                m_sleepCondition.notify_one();
+
+            if (hasWaitingThreads)
+                m_waitCondition.notify_all();
+        }
     }
 
-    void ThreadPool::workerLoop()
+    ThreadPool::QueuedTask* ThreadPool::findTask(Worker* worker)
     {
-        while (true)
+        QueuedTask* task = nullptr;
+
+        if (worker && worker->m_tasks.pop(task))
+        {
+            --m_pendingCount;
+            return task;
+        }
+
+        if (m_queueSize.load(std::memory_order_relaxed) > 0)
         {
-            Action task;
+            std::lock_guard lock(m_queueMutex);
 
+            if (!m_queue.empty())
             {
-                std::unique_lock lock(m_tasksMutex);
-                m_mutexCondition.wait(lock, [this]
-                    {
-                        return !m_tasks.empty() || m_shouldTerminate;
-                    }
-                );
-
-                if (m_shouldTerminate)
-                    return;
-
-                ++m_activeWorkersCount;
-                task = std::move(m_tasks.front());
-                m_tasks.pop();
+                // A waiting external thread would otherwise run the oldest (largest) tasks and nest their waits without bound
+                if (worker)
+                {
+                    task = m_queue.front();
+                    m_queue.pop_front();
+                }
+                else
+                {
+                    task = m_queue.back();
+                    m_queue.pop_back();
+                }
+
+                --m_queueSize;
+                --m_pendingCount;
+                return task;
             }
+        }
+
+        const size_t workersCount = m_workers.size();
 
-            task();
+        if (workersCount == 0)
+            return nullptr;
 
+        thread_local uint32_t externalSeed = 0x2545F491u;
+
+        const size_t first = nextRandom(worker ? worker->m_seed : externalSeed) % workersCount;
+
+        for (size_t i = 0; i < workersCount; ++i)
+        {
+            Worker& victim = *m_workers[(first + i) % workersCount];
+
+            if (&victim != worker && victim.m_tasks.steal(task))
             {
-                std::lock_guard lock(m_tasksMutex);
-                --m_activeWorkersCount;
+                --m_pendingCount;
+                return task;
             }
         }
+
+        return nullptr;
+    }
+
+    void ThreadPool::execute(QueuedTask* task, Worker* worker)
+    {
+        ++m_activeWorkersCount;
+
+        task->m_task();
+
+        // Destroy the task before notifying its counter - waiters may release the state it references
+        TaskCounter* counter = task->m_counter;
+        destroyTask(task, worker);
+
+        if (counter)
+            counter->decrement();
+
+        --m_activeWorkersCount;
+        --m_unfinishedCount;
+
+        // Wake the waiting threads up to check their condition (see helpUntil)
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (m_waitingCount.load() > 0)
+        {
+            {
+                std::lock_guard lock(m_sleepMutex);
+            }
+
+            m_waitCondition.notify_all();
+        }
+    }
+
+    void ThreadPool::destroyTask(QueuedTask* task, Worker* worker)
+    {
+        task->~QueuedTask();
+
+        if (worker)
+        {
+            m_taskAllocator.deallocate(worker->m_taskCache, task);
+            return;
+        }
+
+        std::lock_guard lock(m_queueMutex);
+        m_taskAllocator.deallocate(m_externalCache, task);
+    }
+
+    ThreadPool::Worker* ThreadPool::getLocalWorker() const
+    {
+        return s_localWorker && s_localWorker->m_pool == this ? s_localWorker : nullptr;
+    }
+
+    void ThreadPool::workerLoop(Worker& worker)
+    {
+        s_localWorker = &worker;
+
+        int idleCount = 0;
+
+        while (!m_shouldTerminate.load(std::memory_order_relaxed))
+        {
+            if (QueuedTask* task = findTask(&worker))
+            {
+                execute(task, &worker);
+                idleCount = 0;
+                continue;
+            }
+
+            if (++idleCount < IDLE_SPIN_COUNT)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            std::unique_lock lock(m_sleepMutex);
+            ++m_sleepingCount;
+
+            m_sleepCondition.wait(lock, [this]
+                {
+                    return m_pendingCount.load() > 0 || m_shouldTerminate;
+                }
+            );
+
+            --m_sleepingCount;
+            idleCount = 0;
+        }
+
+        s_localWorker = nullptr;
     }
 }
@@ -0,0 +1,17 @@
+#pragma once
+#include "ITest.h"
+
+namespace PantheonTest
+{
+    class ComponentStorageTest final : public ITest
+    {
+    public:
+        explicit ComponentStorageTest(size_t entityCount = 200000);
+        explicit ComponentStorageTest(const std::string& name, size_t entityCount = 200000);
+
+        void onStart() override;
+
+    private:
+        size_t m_entityCount;
+    };
+}
@@ -18,6 +18,17 @@ namespace PantheonTest
         void testComponentStorage();
         void testComponents();
         void testScene();
+        void testGroups();
+        void testCommandBuffer();
+        void testChangeTracking();
+        void testConcurrentAccess();
+        void testSystemScheduler();
+        void testTransformSystem();
+        void testHierarchyTraversal();
+        void testArchetypeStorage();
+        void testPrefabInstancing();
+        void testSceneSnapshot();
+        void testSceneObserver();
 
         static PantheonCore::ECS::Scene makeScene();
 
@@ -0,0 +1,17 @@
+#pragma once
+#include "ITest.h"
+
+namespace PantheonTest
+{
+    class SceneViewTest final : public ITest
+    {
+    public:
+        explicit SceneViewTest(size_t entityCount = 1000000);
+        explicit SceneViewTest(const std::string& name, size_t entityCount = 1000000);
+
+        void onStart() override;
+
+    private:
+        size_t m_entityCount;
+    };
+}
@@ -14,6 +14,26 @@ namespace PantheonTest
         void onStart() override;
 
     private:
+        /**
+         * \brief Measures the pool's scheduling overhead with empty tasks and nested fork-join at 1 to 16 threads
+         */
+        void benchmarkScheduling();
+
+        /**
+         * \brief Checks the results of parallelFor, parallelReduce and parallelSort and compares them to their sequential version
+         */
+        void testParallelAlgorithms();
+
+        /**
+         * \brief Checks that task graph nodes run once per run and after all of their predecessors, and benchmarks a wide graph
+         */
+        void testTaskGraph();
+
+        /**
+         * \brief Checks that waiting threads execute the pool's tasks, including from a pool without workers and from nested tasks
+         */
+        void testWaiting();
+
         PantheonCore::Utility::ThreadPool* m_threadPool;
 
         size_t m_taskCount;
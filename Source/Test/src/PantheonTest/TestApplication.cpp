@@ -2,8 +2,10 @@
 
 #include "PantheonTest/ComponentRegistrations.h"
 #include "PantheonTest/ResourceRegistrations.h"
+#include "PantheonTest/Tests/ComponentStorageTest.h"
 #include "PantheonTest/Tests/EntitiesTest.h"
 #include "PantheonTest/Tests/InputTest.h"
+#include "PantheonTest/Tests/SceneViewTest.h"
 #include "PantheonTest/Tests/ThreadPoolTest.h"
 #include "PantheonTest/Tests/TypeTraitsTest.h"
 #include "PantheonTest/Tests/WindowTest.h"
@@ -51,6 +53,8 @@ namespace PantheonTest
         m_tests.emplace_back(std::make_unique<InputTest>());
         m_tests.emplace_back(std::make_unique<ThreadPoolTest>());
         m_tests.emplace_back(std::make_unique<EntitiesTest>());
+        m_tests.emplace_back(std::make_unique<ComponentStorageTest>());
+        m_tests.emplace_back(std::make_unique<SceneViewTest>());
     }
 
     void TestApplication::onStart(int, char*[])
@@ -0,0 +1,325 @@
+#include "PantheonTest/Tests/ComponentStorageTest.h"
+
+#include <PantheonCore/ECS/ComponentStorage.h>
+#include <PantheonCore/ECS/EntityHandle.h>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+
+using namespace PantheonCore::ECS;
+
+namespace PantheonTest
+{
+    namespace
+    {
+        struct BenchmarkComponent
+        {
+            float m_position[3];
+            float m_velocity[3];
+        };
+
+        /**
+         * \brief Reference implementation of the hash map based component storage replaced by the sparse set
+         */
+        class MapStorage
+        {
+        public:
+            void construct(const Entity owner, const BenchmarkComponent& component)
+            {
+                m_components.push_back(component);
+                const size_t index = m_components.size() - 1;
+
+                m_componentToEntity[index] = owner;
+                m_entityToComponent[owner] = index;
+            }
+
+            void remove(const Entity owner)
+            {
+                const auto it = m_entityToComponent.find(owner);
+
+                if (it == m_entityToComponent.end())
+                    return;
+
+                const size_t lastIndex = m_components.size() - 1;
+
+                m_componentToEntity[it->second] = m_componentToEntity[lastIndex];
+                std::swap(m_components[it->second], m_components[lastIndex]);
+                m_entityToComponent[m_componentToEntity[it->second]] = it->second;
+
+                m_componentToEntity.erase(lastIndex);
+                m_components.resize(lastIndex);
+                m_entityToComponent.erase(it);
+            }
+
+            bool has(const Entity owner) const
+            {
+                return m_entityToComponent.contains(owner);
+            }
+
+            BenchmarkComponent* find(const Entity owner)
+            {
+                const auto it = m_entityToComponent.find(owner);
+                return it != m_entityToComponent.end() ? &m_components[it->second] : nullptr;
+            }
+
+            size_t getCount() const
+            {
+                return m_components.size();
+            }
+
+            template <typename Func>
+            void each(Func&& func)
+            {
+                for (const auto& [index, entity] : m_componentToEntity)
+                    func(entity, m_components[index]);
+            }
+
+        private:
+            std::vector<BenchmarkComponent>        m_components;
+            std::unordered_map<Entity::Id, size_t> m_entityToComponent;
+            std::unordered_map<size_t, Entity>     m_componentToEntity;
+        };
+
+        template <typename Func>
+        double measure(Func&& func)
+        {
+            const auto start = std::chrono::high_resolution_clock::now();
+            func();
+            const auto end = std::chrono::high_resolution_clock::now();
+
+            return std::chrono::duration<double, std::milli>(end - start).count();
+        }
+    }
+
+    ComponentStorageTest::ComponentStorageTest(const size_t entityCount)
+        : ComponentStorageTest("Component Storage", entityCount)
+    {
+    }
+
+    ComponentStorageTest::ComponentStorageTest(const std::string& name, const size_t entityCount)
+        : ITest(name), m_entityCount(entityCount)
+    {
+    }
+
+    void ComponentStorageTest::onStart()
+    {
+        DEBUG_LOG("Benchmarking component storage - %llu entities (sparse set | hash maps)", m_entityCount);
+
+        std::vector<Entity> entities;
+        entities.reserve(m_entityCount);
+
+        for (Entity::Id i = 0; i < m_entityCount; ++i)
+            entities.emplace_back(i, Entity::Version{});
+
+        std::vector<Entity> shuffled = entities;
+        std::ranges::shuffle(shuffled, std::mt19937(42));
+
+        ComponentStorage<BenchmarkComponent> storage;
+        MapStorage                           mapStorage;
+
+        const auto makeComponent = [](const Entity entity)
+        {
+            const float value = static_cast<float>(entity.getIndex());
+            return BenchmarkComponent{ { value, value, value }, { 1.f, 0.f, 0.f } };
+        };
+
+        double sparseTime = measure([&]
+        {
+            for (const Entity entity : entities)
+                storage.construct(entity, makeComponent(entity));
+        });
+
+        double mapTime = measure([&]
+        {
+            for (const Entity entity : entities)
+                mapStorage.construct(entity, makeComponent(entity));
+        });
+
+        DEBUG_LOG("Insert: %.3fms | %.3fms", sparseTime, mapTime);
+        TEST_CHECK(storage.getCount() == m_entityCount);
+        TEST_CHECK(mapStorage.getCount() == m_entityCount);
+
+        size_t sparseFound = 0;
+        size_t mapFound    = 0;
+
+        sparseTime = measure([&]
+        {
+            for (const Entity entity : shuffled)
+            {
+                if (const BenchmarkComponent* component = storage.find(entity))
+                    sparseFound += static_cast<Entity::Id>(component->m_position[0]) == entity.getIndex();
+            }
+        });
+
+        mapTime = measure([&]
+        {
+            for (const Entity entity : shuffled)
+            {
+                if (const BenchmarkComponent* component = mapStorage.find(entity))
+                    mapFound += static_cast<Entity::Id>(component->m_position[0]) == entity.getIndex();
+            }
+        });
+
+        DEBUG_LOG("Lookup: %.3fms | %.3fms", sparseTime, mapTime);
+        TEST_CHECK(sparseFound == m_entityCount, "Found %llu/%llu components", sparseFound, m_entityCount);
+        TEST_CHECK(mapFound == m_entityCount, "Found %llu/%llu components", mapFound, m_entityCount);
+
+        Entity::Id sparseChecksum = 0;
+        Entity::Id mapChecksum    = 0;
+
+        sparseTime = measure([&]
+        {
+            const SparseSet& owners = storage.getOwners();
+            size_t           index  = 0;
+
+            for (BenchmarkComponent& component : storage)
+            {
+                component.m_position[0] += component.m_velocity[0];
+                sparseChecksum += owners[index++].getIndex();
+            }
+        });
+
+        mapTime = measure([&]
+        {
+            mapStorage.each([&mapChecksum](const Entity owner, BenchmarkComponent& component)
+            {
+                component.m_position[0] += component.m_velocity[0];
+                mapChecksum += owner.getIndex();
+            });
+        });
+
+        DEBUG_LOG("Iteration: %.3fms | %.3fms", sparseTime, mapTime);
+        TEST_CHECK(sparseChecksum == mapChecksum);
+
+        const size_t removedCount = m_entityCount / 2;
+
+        sparseTime = measure([&]
+        {
+            for (size_t i = 0; i < removedCount; ++i)
+                storage.remove(shuffled[i]);
+        });
+
+        mapTime = measure([&]
+        {
+            for (size_t i = 0; i < removedCount; ++i)
+                mapStorage.remove(shuffled[i]);
+        });
+
+        DEBUG_LOG("Remove: %.3fms | %.3fms", sparseTime, mapTime);
+        TEST_CHECK(storage.getCount() == m_entityCount - removedCount);
+        TEST_CHECK(mapStorage.getCount() == m_entityCount - removedCount);
+
+        size_t mismatchCount = 0;
+
+        for (size_t i = 0; i < m_entityCount; ++i)
+        {
+            const bool shouldHave = i >= removedCount;
+            mismatchCount += storage.has(shuffled[i]) != shouldHave || mapStorage.has(shuffled[i]) != shouldHave;
+        }
+
+        TEST_CHECK(mismatchCount == 0, "%llu entities have an invalid component state after removal", mismatchCount);
+
+        std::vector<BenchmarkComponent> components;
+        components.reserve(m_entityCount);
+
+        for (const Entity entity : entities)
+            components.push_back(makeComponent(entity));
+
+        ComponentStorage<BenchmarkComponent> looseStorage;
+        ComponentStorage<BenchmarkComponent> batchStorage;
+
+        size_t addCount    = 0;
+        size_t removeCount = 0;
+
+        const auto onAdd = [&addCount](EntityHandle, BenchmarkComponent&)
+        {
+            ++addCount;
+        };
+
+        const auto onRemove = [&removeCount](EntityHandle, BenchmarkComponent&)
+        {
+            ++removeCount;
+        };
+
+        looseStorage.m_onAdd.subscribe(onAdd);
+        batchStorage.m_onAdd.subscribe(onAdd);
+        batchStorage.m_onRemove.subscribe(onRemove);
+
+        const double looseTime = measure([&]
+        {
+            for (size_t i = 0; i < m_entityCount; ++i)
+                looseStorage.set(entities[i], components[i]);
+        });
+
+        const double batchTime = measure([&]
+        {
+            batchStorage.insertRange(entities.begin(), entities.end(), components.begin());
+        });
+
+        DEBUG_LOG("Bulk insert: %.3fms | %.3fms (set)", batchTime, looseTime);
+        TEST_CHECK(batchStorage.getCount() == m_entityCount);
+        TEST_CHECK(addCount == 2 * m_entityCount, "Expected %llu add events - Got %llu", 2 * m_entityCount, addCount);
+
+        mismatchCount = 0;
+
+        for (const Entity entity : shuffled)
+        {
+            const BenchmarkComponent* component = batchStorage.find(entity);
+            mismatchCount += !component || static_cast<Entity::Id>(component->m_position[0]) != entity.getIndex();
+        }
+
+        TEST_CHECK(mismatchCount == 0, "%llu components don't match their owner after bulk insertion", mismatchCount);
+
+        const double removeTime = measure([&]
+        {
+            batchStorage.removeRange(shuffled.begin(), shuffled.begin() + static_cast<std::ptrdiff_t>(removedCount));
+        });
+
+        DEBUG_LOG("Bulk remove: %.3fms", removeTime);
+        TEST_CHECK(batchStorage.getCount() == m_entityCount - removedCount);
+        TEST_CHECK(removeCount == removedCount, "Expected %llu remove events - Got %llu", removedCount, removeCount);
+
+        mismatchCount = 0;
+
+        for (size_t i = 0; i < m_entityCount; ++i)
+            mismatchCount += batchStorage.has(shuffled[i]) != (i >= removedCount);
+
+        TEST_CHECK(mismatchCount == 0, "%llu entities have an invalid component state after bulk removal", mismatchCount);
+
+        batchStorage.insertRange(shuffled.begin(), shuffled.begin() + 2, components.begin(), false);
+        TEST_CHECK(batchStorage.getCount() == m_entityCount - removedCount + 2);
+        TEST_CHECK(addCount == 2 * m_entityCount, "Deferred insertions shouldn't invoke the add hooks");
+
+        mismatchCount = 0;
+
+        const double ownerTime = measure([&]
+        {
+            const SparseSet& owners = batchStorage.getOwners();
+
+            for (SparseSet::Index index = 0; index < owners.size(); ++index)
+                mismatchCount += batchStorage.getOwner(batchStorage[index]) != owners[index];
+        });
+
+        DEBUG_LOG("Get owner: %.3fms", ownerTime);
+        TEST_CHECK(mismatchCount == 0, "%llu components have an invalid owner", mismatchCount);
+
+        const BenchmarkComponent foreignComponent{};
+        TEST_CHECK(looseStorage.getOwner(foreignComponent) == NULL_ENTITY, "Foreign components shouldn't have an owner");
+
+        const size_t remainingCount = batchStorage.getCount();
+        const Entity removedOwner   = batchStorage.getOwners()[0];
+
+        const double instanceRemoveTime = measure([&]
+        {
+            while (batchStorage.getCount() > 0)
+                batchStorage.remove(*batchStorage.data());
+        });
+
+        DEBUG_LOG("Remove by instance: %.3fms (%llu components)", instanceRemoveTime, remainingCount);
+        TEST_CHECK(batchStorage.getCount() == 0);
+        TEST_CHECK(!batchStorage.has(removedOwner));
+
+        complete();
+    }
+}
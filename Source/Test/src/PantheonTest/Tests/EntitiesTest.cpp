@@ -1,15 +1,107 @@
 #include "PantheonTest/Tests/EntitiesTest.h"
 
+#include <PantheonCore/ECS/ArchetypeStorage.h>
 #include <PantheonCore/ECS/EntityStorage.h>
+#include <PantheonCore/ECS/SceneAccess.h>
+#include <PantheonCore/ECS/SceneCommandBuffer.h>
+#include <PantheonCore/ECS/SceneObserver.h>
+#include <PantheonCore/ECS/SceneSnapshot.h>
 #include <PantheonCore/ECS/SceneView.h>
+#include <PantheonCore/ECS/SystemScheduler.h>
 #include <PantheonCore/ECS/Components/Hierarchy.h>
 #include <PantheonCore/ECS/Components/TagComponent.h>
+#include <PantheonCore/ECS/Systems/TransformSystem.h>
+#include <PantheonCore/Utility/ThreadPool.h>
+
+#include <algorithm>
+#include <utility>
 
 using namespace LibMath;
 using namespace PantheonCore::ECS;
 
 namespace PantheonTest
 {
+    namespace
+    {
+        class IntegrateSystem final : public ISystem
+        {
+        public:
+            SceneAccess getAccess() const override
+            {
+                return SceneAccess().write<float>().read<int>();
+            }
+
+            void update(Scene& scene, const float deltaTime) override
+            {
+                SceneView<float, const int> view(scene);
+
+                for (auto [entity, f, i] : view.each())
+                    f += static_cast<float>(i) * deltaTime;
+            }
+        };
+
+        class ParallelIntegrateSystem final : public ISystem
+        {
+        public:
+            explicit ParallelIntegrateSystem(PantheonCore::Utility::ThreadPool& threadPool)
+                : m_threadPool(&threadPool)
+            {
+            }
+
+            SceneAccess getAccess() const override
+            {
+                return SceneAccess().write<float>().read<int>();
+            }
+
+            void update(Scene& scene, const float deltaTime) override
+            {
+                SceneView<float, const int> view(scene);
+
+                view.parallelEach(*m_threadPool, [deltaTime](float& f, const int& i)
+                {
+                    f += static_cast<float>(i) * deltaTime;
+                }, 64);
+            }
+
+        private:
+            PantheonCore::Utility::ThreadPool* m_threadPool;
+        };
+
+        class CharSystem final : public ISystem
+        {
+        public:
+            SceneAccess getAccess() const override
+            {
+                return SceneAccess().write<char>();
+            }
+
+            void update(Scene& scene, float) override
+            {
+                for (char& c : scene.getStorage<char>())
+                    ++c;
+            }
+        };
+
+        class SumSystem final : public ISystem
+        {
+        public:
+            float m_sum = 0.f;
+
+            SceneAccess getAccess() const override
+            {
+                return SceneAccess().read<float>();
+            }
+
+            void update(Scene& scene, float) override
+            {
+                m_sum = 0.f;
+
+                for (const float f : scene.getStorage<float>())
+                    m_sum += f;
+            }
+        };
+    }
+
     EntitiesTest::EntitiesTest()
         : EntitiesTest("Entities")
     {
@@ -159,6 +251,62 @@ namespace PantheonTest
         {
             TEST_CHECK(false, "The only releveant entity should have been destroyed");
         }
+
+        for (int j = 0; j < 64; ++j)
+        {
+            EntityHandle handle = scene.create();
+            handle.make<int>(j);
+
+            if (j % 16 == 0)
+                handle.make<char>(static_cast<char>('a' + j / 16));
+        }
+
+        SceneView<int, char> sparseView(scene);
+        std::string          visited;
+
+        for (const auto entity : sparseView)
+        {
+            auto [iComp, cComp] = sparseView.get(entity);
+
+            TEST_CHECK(iComp && *iComp % 16 == 0);
+            visited += *cComp;
+        }
+
+        TEST_CHECK(visited == "abcd", "Expected \"abcd\" - Visited \"%s\"", visited.c_str());
+
+        visited.clear();
+
+        for (auto [entity, iComp, cComp] : sparseView.each())
+        {
+            TEST_CHECK(sparseView.get<int>(entity) == &iComp);
+            TEST_CHECK(iComp % 16 == 0);
+
+            visited += cComp;
+            cComp = static_cast<char>(cComp - 'a' + 'A');
+        }
+
+        TEST_CHECK(visited == "abcd", "Expected \"abcd\" - Visited \"%s\"", visited.c_str());
+        visited.clear();
+
+        size_t mismatchCount = 0;
+        sparseView.each([&visited, &mismatchCount, &sparseView](const Entity entity, const int& iComp, const char& cComp)
+        {
+            mismatchCount += sparseView.get<char>(entity) != &cComp || iComp % 16 != 0;
+            visited += cComp;
+        });
+
+        TEST_CHECK(mismatchCount == 0, "%llu components don't match their owner", mismatchCount);
+        TEST_CHECK(visited == "ABCD", "Expected \"ABCD\" - Visited \"%s\"", visited.c_str());
+
+        const SceneView<int, char>& constView = sparseView;
+
+        int sum = 0;
+        constView.each([&sum](const int& iComp, const char&)
+        {
+            sum += iComp;
+        });
+
+        TEST_CHECK(sum == 0 + 16 + 32 + 48, "Expected sum 96 - Got %d", sum);
     }
 
     Scene EntitiesTest::makeScene()
@@ -207,7 +355,19 @@ namespace PantheonTest
 
     void EntitiesTest::onStart()
     {
+        testEntityStorage();
         testScene();
+        testGroups();
+        testCommandBuffer();
+        testChangeTracking();
+        testConcurrentAccess();
+        testSystemScheduler();
+        testTransformSystem();
+        testHierarchyTraversal();
+        testArchetypeStorage();
+        testPrefabInstancing();
+        testSceneSnapshot();
+        testSceneObserver();
         testComponents();
         testJsonSerialization();
         testBinarySerialization();
@@ -229,7 +389,1148 @@ namespace PantheonTest
 
         entityStorage.remove(Entity(1, 0));
         TEST_CHECK(!entityStorage.has(Entity(1, 0)));
+        TEST_CHECK(entityStorage.getCount() == 2);
+
+        Entity::Id expectedIndex = 0;
+        for (const Entity entity : entityStorage)
+        {
+            TEST_CHECK(entity.getIndex() == expectedIndex, "Removed entities should be skipped during iteration");
+            expectedIndex += 2;
+        }
+
+        TEST_CHECK(entityStorage.add() == Entity(1, 1), "Removed entity slots should be recycled with a bumped version");
+        TEST_CHECK(entityStorage.has(Entity(1, 1)));
         TEST_CHECK(!entityStorage.has(Entity(1, 0)));
+        TEST_CHECK(entityStorage.add() == Entity(3, 0));
+
+        entityStorage.remove(Entity(0, 0));
+        entityStorage.remove(Entity(2, 0));
+        TEST_CHECK(entityStorage.add() == Entity(2, 1), "The last removed slot should be recycled first");
+        TEST_CHECK(entityStorage.add() == Entity(0, 1));
+        TEST_CHECK(entityStorage.getCount() == 4);
+    }
+
+    void EntitiesTest::testGroups()
+    {
+        Scene scene;
+
+        for (int i = 0; i < 32; ++i)
+        {
+            EntityHandle entity = scene.create();
+            entity.make<int>(i);
+
+            if (i % 2 == 0)
+                entity.make<float>(static_cast<float>(i));
+        }
+
+        SceneGroup<int, float>& group = *scene.group<int, float>();
+
+        TEST_CHECK((scene.group<int, float>() == &group), "Requesting the same group twice should return the existing one");
+        TEST_CHECK((scene.group<float, int>() == nullptr), "Requesting a group with the same components in another order should fail");
+        TEST_CHECK((scene.group<std::string, float>() == nullptr), "Requesting a group overlapping an existing one should fail");
+        TEST_CHECK(scene.getStorage<std::string>().getGroup() == nullptr, "A failed group request shouldn't take over any storage");
+        TEST_CHECK(group.size() == 16, "Group should contain 16 entities - Found %llu", group.size());
+
+        const auto isPacked = [&scene, &group]
+        {
+            const SparseSet& intOwners   = scene.getStorage<int>().getOwners();
+            const SparseSet& floatOwners = scene.getStorage<float>().getOwners();
+
+            for (size_t i = 0; i < group.size(); ++i)
+            {
+                if (intOwners[i] != floatOwners[i] || !scene.has<float>(intOwners[i]))
+                    return false;
+            }
+
+            return true;
+        };
+
+        TEST_CHECK(isPacked(), "Group entities should be packed at the front of the owned storages in the same order");
+
+        size_t mismatchCount = 0;
+        group.each([&mismatchCount](const int& i, const float& f)
+        {
+            mismatchCount += static_cast<float>(i) != f || i % 2 != 0;
+        });
+
+        TEST_CHECK(mismatchCount == 0, "%llu group components don't match their owner", mismatchCount);
+
+        const Entity oddEntity = scene.getStorage<int>().getOwners()[group.size()];
+        scene.make<float>(oddEntity, 1.f);
+
+        TEST_CHECK(group.size() == 17);
+        TEST_CHECK(group.contains(oddEntity));
+        TEST_CHECK(isPacked());
+
+        const Entity evenEntity = *group.begin();
+        scene.remove<int>(evenEntity);
+
+        TEST_CHECK(group.size() == 16);
+        TEST_CHECK(!group.contains(evenEntity));
+        TEST_CHECK(scene.has<float>(evenEntity));
+        TEST_CHECK(isPacked());
+
+        scene.destroy(oddEntity);
+
+        TEST_CHECK(group.size() == 15);
+        TEST_CHECK(isPacked());
+
+        size_t visitedCount = 0;
+        group.each([&visitedCount, &scene](const Entity entity, int& i, float& f)
+        {
+            visitedCount += scene.get<int>(entity) == &i && scene.get<float>(entity) == &f;
+        });
+
+        TEST_CHECK(visitedCount == group.size(), "Visited %llu/%llu group entities", visitedCount, group.size());
+
+        SceneView<int, float> view(scene);
+        size_t                viewCount = 0;
+
+        for (const auto _ : view)
+            ++viewCount;
+
+        TEST_CHECK(viewCount == group.size(), "Views over grouped storages should find the group's %llu entities - Found %llu",
+            group.size(), viewCount);
+
+        scene.clear();
+        TEST_CHECK(group.empty());
+
+        EntityHandle entity = scene.create();
+        entity.make<float>(1.f);
+        entity.make<int>(1);
+
+        TEST_CHECK(group.size() == 1);
+        TEST_CHECK(group.contains(entity.getEntity()));
+    }
+
+    void EntitiesTest::testCommandBuffer()
+    {
+        Scene scene;
+
+        for (int i = 0; i < 16; ++i)
+        {
+            EntityHandle entity = scene.create();
+            entity.make<int>(i);
+            entity.make<float>(static_cast<float>(i));
+        }
+
+        SceneView<int, float> view(scene);
+        SceneCommandBuffer    commands;
+
+        TEST_CHECK(commands.empty());
+
+        for (auto [entity, i, f] : view.each())
+        {
+            if (i % 2 == 0)
+                commands.destroy(entity);
+            else if (i % 3 == 0)
+                commands.remove<float>(entity);
+            else
+                commands.set<float>(entity, -f);
+        }
+
+        TEST_CHECK(!commands.empty());
+        TEST_CHECK(scene.getStorage<int>().getCount() == 16, "Recorded commands shouldn't be applied before the flush");
+
+        const Entity pending = commands.create();
+        TEST_CHECK(SceneCommandBuffer::isPending(pending));
+        TEST_CHECK(!scene.isValid(pending), "Placeholder entities shouldn't be valid in the scene");
+
+        commands.make<int>(pending, 42);
+        commands.set<float>(pending, 4.2f);
+        commands.remove<float>(pending);
+        commands.make<float>(pending, 2.4f);
+
+        const Entity destroyedPending = commands.create();
+        commands.make<int>(destroyedPending, -1);
+        commands.destroy(destroyedPending);
+
+        commands.flush(scene);
+
+        TEST_CHECK(commands.empty(), "Flushing a command buffer should clear it");
+        TEST_CHECK(scene.getStorage<int>().getCount() == 9, "Expected 9 ints - Found %llu", scene.getStorage<int>().getCount());
+        TEST_CHECK(scene.getStorage<float>().getCount() == 6, "Expected 6 floats - Found %llu",
+            scene.getStorage<float>().getCount());
+
+        size_t mismatchCount = 0;
+        size_t createdCount  = 0;
+
+        SceneView<int> intView(scene);
+
+        for (auto [entity, i] : intView.each())
+        {
+            const float* f = scene.get<float>(entity);
+
+            if (i == 42)
+            {
+                ++createdCount;
+                mismatchCount += f == nullptr || *f != 2.4f;
+            }
+            else if (i % 2 == 0 || i < 0)
+            {
+                ++mismatchCount;
+            }
+            else if (i % 3 == 0)
+            {
+                mismatchCount += f != nullptr;
+            }
+            else
+            {
+                mismatchCount += f == nullptr || *f != -static_cast<float>(i);
+            }
+        }
+
+        TEST_CHECK(createdCount == 1, "Expected 1 entity created by the command buffer - Found %llu", createdCount);
+        TEST_CHECK(mismatchCount == 0, "%llu entities don't match the recorded commands", mismatchCount);
+
+        commands.make<int>(commands.create(), 0);
+        commands.clear();
+        commands.flush(scene);
+
+        TEST_CHECK(scene.getStorage<int>().getCount() == 9, "Cleared commands shouldn't be applied");
+    }
+
+    void EntitiesTest::testChangeTracking()
+    {
+        Scene scene;
+        scene.getStorage<float>().setChangeTracking(true);
+
+        std::vector<Entity> entities;
+
+        for (int i = 0; i < 16; ++i)
+        {
+            EntityHandle entity = scene.create();
+            entity.make<int>(i);
+            entity.make<float>(static_cast<float>(i));
+            entities.push_back(entity.getEntity());
+        }
+
+        SceneView<int, float> view(scene);
+        size_t                changedCount = 0;
+
+        for (const auto _ : view.changedSince(scene.getTick()))
+            ++changedCount;
+
+        TEST_CHECK(changedCount == 16, "Added components should be reported as changed - Found %llu/16", changedCount);
+
+        const Tick tick = scene.advanceTick();
+        changedCount    = 0;
+
+        for (const auto _ : view.changedSince(tick))
+            ++changedCount;
+
+        TEST_CHECK(changedCount == 0, "No component should have changed since the last tick - Found %llu", changedCount);
+
+        scene.set<float>(entities[3], 42.f);
+        scene.make<float>(entities[5], 4.2f);
+        scene.markDirty<float>(entities[7]);
+        scene.set<int>(entities[9], 42);
+
+        // Swap some of the tracked components around to make sure their ticks follow them
+        scene.remove<float>(entities[0]);
+        SceneGroup<float, int>& group = *scene.group<float, int>();
+
+        std::vector<Entity> changed;
+
+        for (auto [entity, i, f] : view.changedSince(tick))
+            changed.push_back(entity);
+
+        std::ranges::sort(changed);
+
+        TEST_CHECK((changed == std::vector{ entities[3], entities[5], entities[7] }),
+            "Only modified and dirty tracked components should be reported as changed - Found %llu", changed.size());
+
+        TEST_CHECK(scene.getStorage<float>().hasChangedSince(entities[3], tick));
+        TEST_CHECK(!scene.getStorage<float>().hasChangedSince(entities[4], tick));
+        TEST_CHECK(!scene.getStorage<int>().hasChangedSince(entities[9], tick), "Untracked storages shouldn't report changes");
+        TEST_CHECK(group.size() == 15);
+
+        const SceneView<int, float>& constView = view;
+        changedCount                           = 0;
+
+        for (const auto _ : constView.changedSince(scene.advanceTick()))
+            ++changedCount;
+
+        TEST_CHECK(changedCount == 0);
+    }
+
+    void EntitiesTest::testConcurrentAccess()
+    {
+        SceneAccess readInts;
+        readInts.read<int, const float>();
+
+        SceneAccess writeInts;
+        writeInts.write<int>().read<int, char>();
+
+        SceneAccess writeChars;
+        writeChars.write<char>();
+
+        TEST_CHECK(readInts.canRead<float>() && !readInts.canWrite<float>());
+        TEST_CHECK(writeInts.canRead<int>() && writeInts.canWrite<int>());
+        TEST_CHECK(writeInts.getReads().size() == 1, "Written types shouldn't be declared as read");
+        TEST_CHECK(!readInts.conflictsWith(readInts), "Concurrent reads shouldn't conflict");
+        TEST_CHECK(readInts.conflictsWith(writeInts) && writeInts.conflictsWith(readInts));
+        TEST_CHECK(!readInts.conflictsWith(writeChars));
+        TEST_CHECK(writeInts.conflictsWith(writeChars));
+
+        Scene scene;
+        scene.registerStorages<int, float, char>();
+
+        for (int i = 0; i < 4096; ++i)
+        {
+            EntityHandle entity = scene.create();
+            entity.make<int>(i);
+            entity.make<float>(static_cast<float>(i));
+            entity.make<char>('a');
+        }
+
+        const Scene& constScene = scene;
+
+        scene.freeze();
+        TEST_CHECK(scene.isFrozen());
+
+        const ComponentStorage<double>& frozenStorage = constScene.getStorage<double>();
+        TEST_CHECK(frozenStorage.getCount() == 0, "Unregistered storages should be empty while the scene is frozen");
+
+        PantheonCore::Utility::ThreadPool threadPool(4);
+        std::vector<std::future<int>>     tasks;
+
+        for (int i = 0; i < 4; ++i)
+        {
+            tasks.emplace_back(threadPool.enqueue([&scene, &constScene, &readInts]
+            {
+                scene.beginAccess(readInts);
+
+                const SceneView<const int, const float> view(constScene);
+                int                                     sum = 0;
+
+                for (auto [entity, i, f] : view.each())
+                    sum += i == static_cast<int>(f);
+
+                scene.endAccess(readInts);
+                return sum;
+            }));
+        }
+
+        scene.beginAccess(writeChars);
+
+        for (char& c : scene.getStorage<char>())
+            c = 'b';
+
+        scene.endAccess(writeChars);
+
+        int validCount = 0;
+
+        for (std::future<int>& task : tasks)
+            validCount += task.get();
+
+        scene.unfreeze();
+
+        TEST_CHECK(validCount == 4 * 4096, "Concurrent readers found %d/%d valid components", validCount, 4 * 4096);
+        TEST_CHECK(std::ranges::all_of(scene.getStorage<char>(), [](const char c) { return c == 'b'; }));
+        TEST_CHECK(&scene.getStorage<double>() != &frozenStorage, "Storages should be created normally once unfrozen");
+    }
+
+    void EntitiesTest::testSystemScheduler()
+    {
+        SystemScheduler scheduler;
+
+        const IntegrateSystem& integrateSystem = scheduler.addSystem<IntegrateSystem>();
+        scheduler.addSystem<CharSystem>();
+        const SumSystem& sumSystem = scheduler.addSystem<SumSystem>();
+
+        TEST_CHECK(scheduler.getSystemCount() == 3);
+        TEST_CHECK(scheduler.getSystem<CharSystem>() == &scheduler.getSystem(1));
+        TEST_CHECK(&scheduler.getSystem(0) == &integrateSystem);
+        TEST_CHECK(scheduler.getDependencies(1).empty(), "Systems without conflicts shouldn't have dependencies");
+        TEST_CHECK(scheduler.getDependencies(2).size() == 1 && scheduler.getDependencies(2)[0] == 0,
+            "Reading a written type should depend on the writer");
+
+        Scene scene;
+        scene.registerStorages<int, float, char>();
+
+        for (int i = 0; i < 1024; ++i)
+        {
+            EntityHandle entity = scene.create();
+            entity.make<int>(1);
+            entity.make<float>(0.f);
+            entity.make<char>('a');
+        }
+
+        PantheonCore::Utility::ThreadPool threadPool(4);
+
+        scheduler.update(scene, 1.f);
+
+        for (int i = 0; i < 8; ++i)
+            scheduler.update(scene, 1.f, threadPool);
+
+        TEST_CHECK(!scene.isFrozen(), "The scene should be unfrozen after an update");
+        TEST_CHECK(sumSystem.m_sum == 9.f * 1024.f, "Readers should run after writers - Expected %f, got %f", 9.f * 1024.f,
+            sumSystem.m_sum);
+        TEST_CHECK(std::ranges::all_of(scene.getStorage<char>(), [](const char c) { return c == 'a' + 9; }));
+        TEST_CHECK(scheduler.getFrameTime() >= scheduler.getUpdateTime(0));
+
+        for (SystemScheduler::SystemId id = 0; id < scheduler.getSystemCount(); ++id)
+        {
+            TEST_CHECK(scheduler.getUpdateTime(id) > 0.f, "System %llu's update time should be recorded", id);
+        }
+
+        // A system running on the pool's only worker dispatches chunks to that same pool - the waits have to help
+        PantheonCore::Utility::ThreadPool singleWorkerPool(1);
+        SystemScheduler                   nestedScheduler;
+
+        nestedScheduler.addSystem<ParallelIntegrateSystem>(singleWorkerPool);
+        const SumSystem& nestedSumSystem = nestedScheduler.addSystem<SumSystem>();
+
+        for (float& f : scene.getStorage<float>())
+            f = 0.f;
+
+        for (int i = 0; i < 4; ++i)
+            nestedScheduler.update(scene, 1.f, singleWorkerPool);
+
+        TEST_CHECK(nestedSumSystem.m_sum == 4.f * 1024.f, "Nested parallel systems should complete - Expected %f, got %f",
+            4.f * 1024.f, nestedSumSystem.m_sum);
+    }
+
+    void EntitiesTest::testTransformSystem()
+    {
+        Scene           scene;
+        TransformSystem transformSystem(scene);
+
+        EntityHandle root = scene.create();
+        root.make<Transform>(Vector3(1.f, 0.f, 0.f), Quaternion::identity(), Vector3::one());
+
+        EntityHandle child = scene.create();
+        child.make<Transform>(Vector3(0.f, 1.f, 0.f), Quaternion::identity(), Vector3::one());
+        child.setParent(root);
+
+        EntityHandle group = scene.create();
+        group.setParent(child);
+
+        EntityHandle leaf = scene.create();
+        leaf.make<Transform>(Vector3(0.f, 0.f, 1.f), Quaternion::identity(), Vector3::one());
+        leaf.setParent(group);
+
+        EntityHandle sibling = scene.create();
+        sibling.make<Transform>(Vector3(2.f, 0.f, 0.f), Quaternion::identity(), Vector3::one());
+        sibling.setParent(root);
+
+        EntityHandle standalone = scene.create();
+        standalone.make<Transform>();
+
+        transformSystem.update(scene, 0.f);
+
+        TEST_CHECK(transformSystem.getCount() == 5, "Only entities with a transform should be updated");
+        TEST_CHECK(transformSystem.getUpdatedCount() == 5, "The first update should compute every world matrix");
+        TEST_CHECK(transformSystem.find(group) == TransformSystem::INVALID_INDEX);
+        TEST_CHECK(transformSystem.find(root) < transformSystem.find(child), "Parents should precede their children");
+        TEST_CHECK(transformSystem.find(child) < transformSystem.find(leaf),
+            "Children should be linked to their closest ancestor with a transform");
+        TEST_CHECK(transformSystem.find(root) < transformSystem.find(sibling));
+
+        const auto matchesTransform = [&transformSystem](const EntityHandle entity)
+        {
+            const LibMath::Matrix4* worldMatrix = transformSystem.findWorldMatrix(entity);
+            return worldMatrix && *worldMatrix == entity.get<Transform>()->getWorldMatrix();
+        };
+
+        TEST_CHECK(matchesTransform(root) && matchesTransform(child) && matchesTransform(leaf) && matchesTransform(sibling));
+
+        // One tick per frame, advanced after the transforms' update
+        scene.advanceTick();
+        transformSystem.update(scene, 0.f);
+        scene.advanceTick();
+
+        TEST_CHECK(transformSystem.getUpdatedCount() == 0, "Unmodified transforms shouldn't be updated - Updated %llu",
+            transformSystem.getUpdatedCount());
+
+        leaf.get<Transform>()->setPosition(Vector3(0.f, 0.f, 2.f));
+        scene.markDirty<Transform>(leaf);
+        transformSystem.update(scene, 0.f);
+        scene.advanceTick();
+
+        TEST_CHECK(transformSystem.getUpdatedCount() == 1, "Only the modified leaf should be updated - Updated %llu",
+            transformSystem.getUpdatedCount());
+        TEST_CHECK(matchesTransform(leaf));
+
+        transformSystem.update(scene, 0.f);
+        scene.advanceTick();
+
+        TEST_CHECK(transformSystem.getUpdatedCount() == 0, "Processed changes shouldn't be updated again - Updated %llu",
+            transformSystem.getUpdatedCount());
+
+        root.get<Transform>()->setPosition(Vector3(-1.f, 0.f, 0.f));
+        scene.markDirty<Transform>(root);
+        transformSystem.update(scene, 0.f);
+        scene.advanceTick();
+
+        TEST_CHECK(transformSystem.getUpdatedCount() == 4, "The modified root's subtree should be updated - Updated %llu",
+            transformSystem.getUpdatedCount());
+        TEST_CHECK(matchesTransform(root) && matchesTransform(child) && matchesTransform(leaf) && matchesTransform(sibling));
+
+        group.setParent(sibling);
+        transformSystem.update(scene, 0.f);
+        scene.advanceTick();
+
+        TEST_CHECK(transformSystem.find(sibling) < transformSystem.find(leaf), "Reparenting should reorder the transforms");
+        TEST_CHECK(matchesTransform(leaf));
+
+        sibling.destroy();
+        transformSystem.update(scene, 0.f);
+        scene.advanceTick();
+
+        TEST_CHECK(transformSystem.getCount() == 3, "Destroyed subtrees should be removed - Found %llu transforms",
+            transformSystem.getCount());
+        TEST_CHECK(transformSystem.findWorldMatrix(leaf) == nullptr);
+
+        // Wide forest - the root subtrees should be split across the pool's workers
+        constexpr size_t rootCount = 256;
+        constexpr size_t treeSize  = 64;
+
+        std::vector<EntityHandle> roots;
+
+        for (size_t i = 0; i < rootCount; ++i)
+        {
+            EntityHandle treeRoot = scene.create();
+            treeRoot.make<Transform>(Vector3(static_cast<float>(i), 0.f, 0.f), Quaternion::identity(), Vector3::one());
+            roots.push_back(treeRoot);
+
+            std::vector<EntityHandle> tree{ treeRoot };
+
+            for (size_t j = 1; j < treeSize; ++j)
+            {
+                EntityHandle node = scene.create();
+                node.make<Transform>(Vector3(0.f, static_cast<float>(j), 0.f), Quaternion::identity(), Vector3::one());
+                node.setParent(tree[(j - 1) / 2]);
+                tree.push_back(node);
+            }
+        }
+
+        PantheonCore::Utility::ThreadPool threadPool(4);
+        TransformSystem                   parallelSystem(scene, &threadPool);
+
+        transformSystem.update(scene, 0.f);
+        parallelSystem.update(scene, 0.f);
+        scene.advanceTick();
+
+        const size_t forestSize = transformSystem.getCount();
+
+        TEST_CHECK(parallelSystem.getPartitionCount() > 1, "The forest should be split into several partitions");
+        TEST_CHECK(parallelSystem.getCount() == forestSize && parallelSystem.getUpdatedCount() == forestSize);
+
+        transformSystem.update(scene, 0.f);
+        parallelSystem.update(scene, 0.f);
+        scene.advanceTick();
+
+        TEST_CHECK(parallelSystem.getUpdatedCount() == 0, "Unmodified subtrees shouldn't be updated - Updated %llu",
+            parallelSystem.getUpdatedCount());
+
+        for (size_t i = 0; i < rootCount; i += 2)
+        {
+            roots[i].get<Transform>()->setPosition(Vector3(0.f, 0.f, static_cast<float>(i)));
+            scene.markDirty<Transform>(roots[i]);
+        }
+
+        transformSystem.update(scene, 0.f);
+        parallelSystem.update(scene, 0.f);
+
+        TEST_CHECK(parallelSystem.getUpdatedCount() == rootCount / 2 * treeSize,
+            "Only the modified subtrees should be updated - Updated %llu", parallelSystem.getUpdatedCount());
+
+        bool isMatching = true;
+
+        for (const Entity owner : scene.getStorage<Transform>().getOwners())
+        {
+            const LibMath::Matrix4* expected = transformSystem.findWorldMatrix(owner);
+            const LibMath::Matrix4* actual   = parallelSystem.findWorldMatrix(owner);
+
+            isMatching &= expected && actual && *expected == *actual;
+        }
+
+        TEST_CHECK(isMatching, "Parallel and sequential propagation should compute the same world matrices");
+    }
+
+    void EntitiesTest::testHierarchyTraversal()
+    {
+        Scene scene;
+
+        // 0 -> { 1 -> { 3, 4 }, 2 -> { 5 } }
+        std::vector<EntityHandle> entities;
+
+        for (int i = 0; i < 6; ++i)
+        {
+            EntityHandle entity = scene.create();
+            entity.make<int>(i);
+            entities.push_back(entity);
+        }
+
+        // Children are linked at the front of their parent's children - add them in reverse order
+        entities[2].setParent(entities[0]);
+        entities[1].setParent(entities[0]);
+        entities[4].setParent(entities[1]);
+        entities[3].setParent(entities[1]);
+        entities[5].setParent(entities[2]);
+
+        std::vector<int> visited;
+
+        for (EntityHandle child : entities[0].children())
+            visited.push_back(*child.get<int>());
+
+        TEST_CHECK((visited == std::vector{ 1, 2 }), "Child ranges should follow the sibling links");
+        TEST_CHECK(entities[3].children().empty());
+
+        visited.clear();
+
+        for (EntityHandle ancestor : entities[5].ancestors())
+            visited.push_back(*ancestor.get<int>());
+
+        TEST_CHECK((visited == std::vector{ 2, 0 }), "Ancestor ranges should go from the parent to the root");
+        TEST_CHECK(entities[4].getRoot().getEntity() == entities[0].getEntity());
+        TEST_CHECK(entities[5].getInParent<int>() == entities[5].get<int>());
+
+        visited.clear();
+
+        TEST_CHECK(entities[0].visitDepthFirst([&visited](EntityHandle entity)
+        {
+            visited.push_back(*entity.get<int>());
+        }));
+
+        TEST_CHECK((visited == std::vector{ 0, 1, 3, 4, 2, 5 }), "Depth-first visits should visit parents before children");
+
+        visited.clear();
+
+        entities[0].visitDepthFirst([&visited](EntityHandle entity)
+        {
+            visited.push_back(*entity.get<int>());
+            return visited.back() == 1 ? EntityHandle::EVisitResult::SKIP_CHILDREN : EntityHandle::EVisitResult::CONTINUE;
+        });
+
+        TEST_CHECK((visited == std::vector{ 0, 1, 2, 5 }), "Skipped subtrees shouldn't be visited");
+
+        visited.clear();
+
+        TEST_CHECK(entities[1].visitDepthFirst([&visited](EntityHandle entity)
+        {
+            visited.push_back(*entity.get<int>());
+        }));
+
+        TEST_CHECK((visited == std::vector{ 1, 3, 4 }), "Visits shouldn't leave the visited subtree");
+
+        visited.clear();
+
+        TEST_CHECK(entities[0].visitBreadthFirst([&visited](EntityHandle entity)
+        {
+            visited.push_back(*entity.get<int>());
+        }));
+
+        TEST_CHECK((visited == std::vector{ 0, 1, 2, 3, 4, 5 }), "Breadth-first visits should go level by level");
+
+        visited.clear();
+
+        TEST_CHECK(!entities[0].visitBreadthFirst([&visited](EntityHandle entity)
+        {
+            visited.push_back(*entity.get<int>());
+            return visited.size() == 3 ? EntityHandle::EVisitResult::STOP : EntityHandle::EVisitResult::CONTINUE;
+        }), "Stopped visits should return false");
+
+        TEST_CHECK(visited.size() == 3);
+
+        visited.clear();
+
+        entities[0].visitPostOrder([&visited](EntityHandle entity)
+        {
+            visited.push_back(*entity.get<int>());
+        });
+
+        TEST_CHECK((visited == std::vector{ 3, 4, 1, 5, 2, 0 }), "Post-order visits should visit children before parents");
+
+        entities[1].visitPostOrder([](EntityHandle entity)
+        {
+            entity.destroy();
+        });
+
+        TEST_CHECK(!entities[1] && !entities[3] && !entities[4], "Post-order visits should support destroying visited entities");
+        TEST_CHECK(entities[0].getChildCount() == 1 && entities[0].getFirstChild().getEntity() == entities[2].getEntity());
+
+        scene.clear();
+
+        constexpr size_t nodeCount = 50000;
+
+        EntityHandle root = scene.create();
+        entities.assign(1, root);
+
+        for (size_t i = 1; i < nodeCount; ++i)
+        {
+            EntityHandle entity = scene.create();
+            entity.setParent(entities[(i - 1) / 4]);
+            entities.push_back(entity);
+        }
+
+        size_t visitedCount = 0;
+        root.visitDepthFirst([&visitedCount](EntityHandle)
+        {
+            ++visitedCount;
+        });
+
+        TEST_CHECK(visitedCount == nodeCount, "Expected %llu visited nodes - Found %llu", nodeCount, visitedCount);
+
+        root.destroy();
+        TEST_CHECK(scene.getStorage<HierarchyComponent>().getCount() == 0, "Destroying a root should destroy its whole subtree");
+        TEST_CHECK(std::ranges::none_of(entities, [](const EntityHandle& entity) { return static_cast<bool>(entity); }));
+    }
+
+    void EntitiesTest::testArchetypeStorage()
+    {
+        Scene scene(Scene::EStorageMode::ARCHETYPE);
+
+        TEST_CHECK(scene.getStorageMode() == Scene::EStorageMode::ARCHETYPE);
+        TEST_CHECK(scene.isArchetypeComponent<int>() && !scene.isArchetypeComponent<HierarchyComponent>());
+        TEST_CHECK(!Scene().isArchetypeComponent<int>(), "Sparse set scenes shouldn't store components in archetypes");
+
+        const ArchetypeStorage& archetypes = scene.getArchetypeStorage();
+
+        EntityHandle first = scene.create();
+        first.make<int>(1);
+        first.make<float>(1.5f);
+        first.make<std::string>("first");
+
+        EntityHandle second = scene.create();
+        second.make<std::string>("second");
+        second.make<float>(2.5f);
+        second.make<int>(2);
+
+        TEST_CHECK(first.has<int>() && first.has<float>() && first.has<std::string>());
+        TEST_CHECK(*first.get<int>() == 1 && *first.get<float>() == 1.5f && *first.get<std::string>() == "first",
+            "Components should be preserved when their owner changes archetype");
+        TEST_CHECK(archetypes.findArchetype(first.getEntity()) == archetypes.findArchetype(second.getEntity()),
+            "Entities with the same component types should share an archetype regardless of the insertion order");
+        TEST_CHECK(archetypes.getCount() == 2);
+
+        second.set<int>(-2);
+        TEST_CHECK(*second.get<int>() == -2);
+
+        first.remove<float>();
+        TEST_CHECK(!first.has<float>() && *first.get<int>() == 1 && *first.get<std::string>() == "first");
+        TEST_CHECK(*second.get<float>() == 2.5f && *second.get<std::string>() == "second",
+            "Moving an entity shouldn't affect the other entities of its archetype");
+
+        scene.remove(*second.get<float>());
+        TEST_CHECK(!second.has<float>() && *second.get<int>() == -2, "Removing a component instance should find its owner");
+
+        EntityHandle copy = scene.create(first.getEntity());
+        TEST_CHECK(*copy.get<int>() == 1 && *copy.get<std::string>() == "first" && !copy.has<float>());
+
+        first.destroy();
+        TEST_CHECK(*copy.get<std::string>() == "first" && archetypes.getCount() == 2);
+
+        scene.clear();
+        TEST_CHECK(archetypes.getCount() == 0);
+
+        // Fill several chunks with a mix of archetype and sparse components
+        constexpr int entityCount = 5000;
+
+        EntityHandle root = scene.create();
+        Entity       last = NULL_ENTITY;
+
+        for (int i = 0; i < entityCount; ++i)
+        {
+            EntityHandle entity = scene.create();
+            entity.make<int>(i);
+            last = entity.getEntity();
+
+            if (i % 2 == 0)
+                entity.make<float>(static_cast<float>(i));
+
+            if (i % 5 == 0)
+                entity.setParent(root);
+        }
+
+        const Archetype& intArchetype = archetypes.getArchetype(archetypes.findArchetype(last));
+        TEST_CHECK(intArchetype.getChunkCount() > 1, "Expected several chunks - Found %llu", intArchetype.getChunkCount());
+
+        SceneView<int, float> view(scene);
+        int                   sum   = 0;
+        size_t                count = 0;
+
+        for (auto [entity, i, f] : view.each())
+        {
+            TEST_CHECK(static_cast<float>(i) == f);
+            sum += i;
+            ++count;
+        }
+
+        TEST_CHECK(count == entityCount / 2, "Expected %d entities - Found %llu", entityCount / 2, count);
+        TEST_CHECK(sum == (entityCount / 2 - 1) * entityCount / 2);
+
+        SceneView<const int, HierarchyComponent> childView(scene);
+        count = 0;
+
+        childView.each([&count, &root](const Entity, const int& i, const HierarchyComponent& hierarchy)
+        {
+            count += i % 5 == 0 && hierarchy.getParent() == root.getEntity();
+        });
+
+        TEST_CHECK(count == entityCount / 5, "Expected %d children - Found %llu", entityCount / 5, count);
+
+        PantheonCore::Utility::ThreadPool threadPool(4);
+        view.parallelEach(threadPool, [](int& i, float& f)
+        {
+            f = static_cast<float>(i) * 2.f;
+        }, 256);
+
+        size_t mismatchCount = 0;
+
+        std::as_const(view).each([&mismatchCount](const int& i, const float& f)
+        {
+            mismatchCount += static_cast<float>(i) * 2.f != f;
+        });
+
+        TEST_CHECK(mismatchCount == 0, "%llu entities weren't updated by the parallel iteration", mismatchCount);
+
+        // The same gameplay code should produce the same results with both storage modes
+        const auto simulate = [](Scene& target)
+        {
+            std::vector<Entity> entities;
+
+            for (int i = 0; i < 1000; ++i)
+            {
+                EntityHandle entity = target.create();
+                entity.make<int>(i);
+                entities.push_back(entity.getEntity());
+
+                if (i % 3 == 0)
+                    entity.make<float>(.5f);
+            }
+
+            SceneView<int>     intView(target);
+            SceneCommandBuffer commands;
+
+            for (auto [entity, i] : intView.each())
+            {
+                if (i % 7 == 0)
+                    commands.destroy(entity);
+                else if (i % 2 == 0)
+                    commands.make<float>(entity, static_cast<float>(i));
+            }
+
+            commands.flush(target);
+
+            SceneView<int, float> floatView(target);
+            floatView.each([](int& i, float& f)
+            {
+                i += static_cast<int>(f);
+            });
+
+            std::vector<int> values;
+
+            for (const Entity entity : entities)
+            {
+                const int*   i = target.isValid(entity) ? target.get<int>(entity) : nullptr;
+                const float* f = target.isValid(entity) ? target.get<float>(entity) : nullptr;
+                values.push_back(i ? *i : -1);
+                values.push_back(f ? static_cast<int>(*f) : -1);
+            }
+
+            return values;
+        };
+
+        Scene sparseScene;
+        Scene archetypeScene(Scene::EStorageMode::ARCHETYPE);
+
+        TEST_CHECK(simulate(sparseScene) == simulate(archetypeScene), "Both storage modes should produce the same results");
+    }
+
+    void EntitiesTest::testPrefabInstancing()
+    {
+        for (const Scene::EStorageMode storageMode : { Scene::EStorageMode::SPARSE_SET, Scene::EStorageMode::ARCHETYPE })
+        {
+            Scene scene(storageMode);
+
+            // prefab -> { first -> { nested }, second }
+            EntityHandle prefab = scene.create();
+            prefab.make<int>(0);
+            prefab.make<std::string>("prefab");
+
+            EntityHandle second = scene.create();
+            second.make<int>(2);
+            second.setParent(prefab);
+
+            EntityHandle first = scene.create();
+            first.make<int>(1);
+            first.setParent(prefab);
+
+            EntityHandle nested = scene.create();
+            nested.make<int>(3);
+            nested.make<float>(3.f);
+            nested.setParent(first);
+
+            const auto getValues = [](const EntityHandle root)
+            {
+                std::vector<int> values;
+
+                root.visitDepthFirst([&values](const EntityHandle entity)
+                {
+                    values.push_back(*entity.get<int>());
+                });
+
+                return values;
+            };
+
+            constexpr size_t instanceCount = 1000;
+
+            const std::vector<int>    prefabValues = getValues(prefab);
+            const std::vector<Entity> instances    = scene.instantiate(prefab, instanceCount);
+
+            TEST_CHECK(instances.size() == instanceCount, "Expected %llu instances - Found %llu", instanceCount, instances.size());
+            TEST_CHECK(scene.instantiate(NULL_ENTITY, 4).empty(), "Invalid prefabs shouldn't be instantiated");
+
+            size_t mismatchCount = 0;
+
+            for (const Entity instance : instances)
+            {
+                const EntityHandle root(&scene, instance);
+
+                mismatchCount += getValues(root) != prefabValues || root.getParent() || root.getChildCount() != 2
+                    || *root.get<std::string>() != "prefab";
+            }
+
+            TEST_CHECK(mismatchCount == 0, "%llu instances don't match their prefab", mismatchCount);
+            TEST_CHECK(prefab.getChildCount() == 2 && getValues(prefab) == prefabValues, "Instancing shouldn't modify the prefab");
+
+            const EntityHandle lastRoot(&scene, instances.back());
+            const EntityHandle lastNested = lastRoot.getFirstChild().getFirstChild();
+
+            TEST_CHECK(lastNested.getParent().getParent().getEntity() == lastRoot.getEntity());
+            TEST_CHECK(lastNested.get<float>() && *lastNested.get<float>() == 3.f);
+
+            SceneView<const int> view(scene);
+            size_t               count = 0;
+
+            view.each([&count](const int&)
+            {
+                ++count;
+            });
+
+            TEST_CHECK(count == 4 * (instanceCount + 1), "Expected %llu entities - Found %llu", 4 * (instanceCount + 1), count);
+
+            EntityHandle(&scene, instances.front()).destroy();
+
+            count = 0;
+
+            view.each([&count](const int&)
+            {
+                ++count;
+            });
+
+            TEST_CHECK(count == 4 * instanceCount, "Destroying an instance should only destroy its own subtree");
+            TEST_CHECK(getValues(lastRoot) == prefabValues);
+        }
+    }
+
+    void EntitiesTest::testSceneSnapshot()
+    {
+        Scene scene;
+
+        std::vector<Entity> entities;
+
+        for (int i = 0; i < 100; ++i)
+        {
+            EntityHandle entity = scene.create();
+            entity.make<int>(i);
+            entities.push_back(entity.getEntity());
+
+            if (i % 2 == 0)
+                entity.make<std::string>(std::to_string(i));
+
+            if (i % 10 == 0 && i > 0)
+                entity.setParent(EntityHandle(&scene, entities.front()));
+        }
+
+        SceneGroup<int, std::string>& group = *scene.group<int, std::string>();
+        scene.getStorage<int>().setChangeTracking(true);
+
+        SceneSnapshot snapshot(1024);
+        TEST_CHECK(snapshot.empty() && snapshot.getCapacity() == 1024);
+        TEST_CHECK(scene.saveSnapshot(snapshot));
+        TEST_CHECK(!snapshot.empty() && snapshot.getSize() <= snapshot.getCapacity());
+
+        const size_t capacity = snapshot.getCapacity();
+
+        // Restoring the same snapshot several times should always produce the captured state
+        for (int attempt = 0; attempt < 3; ++attempt)
+        {
+            for (size_t i = 0; i < entities.size(); i += 3)
+                scene.destroy(entities[i]);
+
+            for (const Entity entity : entities)
+            {
+                if (int* value = scene.get<int>(entity))
+                    *value = -1;
+            }
+
+            EntityHandle extra = scene.create();
+            extra.make<float>(1.f);
+            extra.make<std::string>("extra");
+
+            TEST_CHECK(scene.restoreSnapshot(snapshot));
+
+            size_t mismatchCount = 0;
+
+            for (int i = 0; i < static_cast<int>(entities.size()); ++i)
+            {
+                const Entity       entity = entities[static_cast<size_t>(i)];
+                const int*         value  = scene.get<int>(entity);
+                const std::string* name   = scene.get<std::string>(entity);
+
+                mismatchCount += !scene.isValid(entity) || !value || *value != i;
+                mismatchCount += i % 2 == 0 ? !name || *name != std::to_string(i) : name != nullptr;
+            }
+
+            TEST_CHECK(mismatchCount == 0, "%llu restored components don't match the snapshot", mismatchCount);
+            TEST_CHECK(!scene.isValid(extra.getEntity()), "Entities created after the capture shouldn't survive a restore");
+            TEST_CHECK(scene.getStorage<float>().getCount() == 0, "Storages created after the capture should be cleared");
+            TEST_CHECK(scene.getStorage<int>().isTrackingChanges());
+            TEST_CHECK(group.size() == 50, "Expected 50 grouped entities - Found %llu", group.size());
+            TEST_CHECK(EntityHandle(&scene, entities.front()).getChildCount() == 9);
+        }
+
+        const Entity created = scene.create().getEntity();
+        TEST_CHECK(scene.restoreSnapshot(snapshot));
+        TEST_CHECK(scene.create().getEntity() == created, "The entities' free list and versions should be restored");
+        TEST_CHECK(scene.restoreSnapshot(snapshot));
+
+        // Snapshots can be restored in another scene, reusing the arena across captures
+        TEST_CHECK(scene.saveSnapshot(snapshot));
+        TEST_CHECK(snapshot.getCapacity() == capacity, "Captures of a similar scene shouldn't grow the arena");
+
+        Scene copy;
+        TEST_CHECK(copy.restoreSnapshot(snapshot));
+        TEST_CHECK(copy.getStorage<int>().getCount() == scene.getStorage<int>().getCount());
+        TEST_CHECK(*copy.get<std::string>(entities[98]) == "98");
+
+        // Moved snapshots are left empty, without an arena
+        SceneSnapshot moved(std::move(snapshot));
+        TEST_CHECK(copy.restoreSnapshot(moved));
+        TEST_CHECK(snapshot.empty() && snapshot.getSize() == 0 && snapshot.getCapacity() == 0);
+
+        snapshot.reserve(1024);
+        TEST_CHECK(snapshot.getCapacity() >= 1024, "Moved snapshots should be able to allocate a new arena");
+
+        Scene archetypeScene(Scene::EStorageMode::ARCHETYPE);
+        TEST_CHECK(!archetypeScene.saveSnapshot(snapshot), "Archetype scenes can't be captured");
+    }
+
+    void EntitiesTest::testSceneObserver()
+    {
+        Scene scene;
+
+        std::vector<Entity> entities;
+
+        for (int i = 0; i < 300; ++i)
+        {
+            EntityHandle entity = scene.create();
+            entities.push_back(entity.getEntity());
+
+            if (i % 2 == 0)
+                entity.make<int>(i);
+
+            if (i % 3 == 0)
+                entity.make<float>(static_cast<float>(i));
+
+            if (i % 5 == 0)
+                entity.make<char>('x');
+        }
+
+        auto& observer = scene.observe<int, float>(Exclude<char>{});
+
+        TEST_CHECK((&scene.observe<int, float>(Exclude<char>{}) == &observer), "Requesting the same observer twice should return the existing one");
+        TEST_CHECK((static_cast<void*>(&scene.observe<int, float>()) != static_cast<void*>(&observer)),
+            "Observers with different filters should be distinct");
+
+        // Compare the observer's matches with a full scan of the scene's entities
+        const auto countMismatches = [&scene, &observer]
+        {
+            size_t expected   = 0;
+            size_t mismatches = 0;
+
+            for (const Entity entity : scene.getStorage<Entity>())
+            {
+                const bool isMatch = scene.has<int>(entity) && scene.has<float>(entity) && !scene.has<char>(entity);
+
+                expected += isMatch;
+                mismatches += isMatch != observer.contains(entity);
+            }
+
+            return mismatches + (expected != observer.size());
+        };
+
+        TEST_CHECK(observer.size() == 40, "Expected 40 initial matches - Found %llu", observer.size());
+        TEST_CHECK(countMismatches() == 0);
+
+        // Adding and removing included and excluded components
+        scene.make<float>(entities[2], 2.f);
+        scene.remove<char>(entities[30]);
+        scene.make<char>(entities[6], 'y');
+        scene.remove<int>(entities[12]);
+        scene.remove<float>(entities[18]);
+
+        TEST_CHECK(observer.contains(entities[2]) && observer.contains(entities[30]));
+        TEST_CHECK(!observer.contains(entities[6]) && !observer.contains(entities[12]) && !observer.contains(entities[18]));
+        TEST_CHECK(countMismatches() == 0);
+
+        // Replacing an existing component doesn't change the matches
+        scene.make<int>(entities[24], 24);
+        scene.remove<char>(entities[1]);
+        TEST_CHECK(observer.contains(entities[24]) && !observer.contains(entities[1]));
+
+        for (size_t i = 0; i < entities.size(); i += 7)
+            scene.destroy(entities[i]);
+
+        TEST_CHECK(countMismatches() == 0);
+
+        // Batched operations invoke the storages' events
+        const std::vector<Entity> instances = scene.instantiate(entities[36], 10);
+        TEST_CHECK(instances.size() == 10 && observer.contains(instances.back()));
+        TEST_CHECK(countMismatches() == 0);
+
+        SceneCommandBuffer commands;
+        commands.make<char>(instances[0], 'z');
+        commands.remove<int>(instances[1]);
+        commands.flush(scene);
+        TEST_CHECK(!observer.contains(instances[0]) && !observer.contains(instances[1]));
+        TEST_CHECK(countMismatches() == 0);
+
+        size_t iterated = 0;
+        bool   isValid  = true;
+
+        observer.each([&iterated, &isValid](const Entity, const int& intValue, const float& floatValue)
+        {
+            ++iterated;
+            isValid &= static_cast<float>(intValue) == floatValue;
+        });
+
+        TEST_CHECK(iterated == observer.size() && isValid);
+
+        // Snapshot restores and clears bypass the events - the scene refreshes its observers
+        SceneSnapshot snapshot;
+        TEST_CHECK(scene.saveSnapshot(snapshot));
+
+        const size_t matchCount = observer.size();
+
+        for (const Entity match : std::vector<Entity>(observer.begin(), observer.end()))
+            scene.make<char>(match, 'w');
+
+        TEST_CHECK(observer.empty());
+        TEST_CHECK(scene.restoreSnapshot(snapshot));
+        TEST_CHECK(observer.size() == matchCount && countMismatches() == 0);
+
+        scene.clear();
+        TEST_CHECK(observer.empty());
+
+        EntityHandle entity = scene.create();
+        entity.make<int>(1);
+        entity.make<float>(1.f);
+        TEST_CHECK(observer.size() == 1 && observer.data()[0] == entity.getEntity());
     }
 
     void EntitiesTest::testComponentStorage()
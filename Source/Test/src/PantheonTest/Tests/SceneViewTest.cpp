@@ -0,0 +1,166 @@
+#include "PantheonTest/Tests/SceneViewTest.h"
+
+#include <PantheonCore/ECS/SceneView.h>
+#include <PantheonCore/Utility/ServiceLocator.h>
+
+#include <Transform.h>
+
+#include <atomic>
+#include <chrono>
+#include <utility>
+
+using namespace LibMath;
+using namespace PantheonCore::ECS;
+using namespace PantheonCore::Utility;
+
+namespace PantheonTest
+{
+    namespace
+    {
+        struct Velocity
+        {
+            Vector3 m_value;
+            size_t  m_updateCount = 0;
+        };
+
+        struct Position
+        {
+            Vector3 m_value;
+        };
+
+        template <typename Func>
+        double measure(Func&& func)
+        {
+            const auto start = std::chrono::high_resolution_clock::now();
+            func();
+            const auto end = std::chrono::high_resolution_clock::now();
+
+            return std::chrono::duration<double, std::milli>(end - start).count();
+        }
+    }
+
+    SceneViewTest::SceneViewTest(const size_t entityCount)
+        : SceneViewTest("Scene View", entityCount)
+    {
+    }
+
+    SceneViewTest::SceneViewTest(const std::string& name, const size_t entityCount)
+        : ITest(name), m_entityCount(entityCount)
+    {
+    }
+
+    void SceneViewTest::onStart()
+    {
+        DEBUG_LOG("Benchmarking scene view iteration - %llu transforms", m_entityCount);
+
+        Scene scene;
+        scene.getStorage<Transform>().reserve(static_cast<Entity::Id>(m_entityCount));
+        scene.getStorage<Velocity>().reserve(static_cast<Entity::Id>(m_entityCount));
+
+        for (size_t i = 0; i < m_entityCount; ++i)
+        {
+            EntityHandle entity = scene.create();
+            entity.make<Transform>(Vector3(static_cast<float>(i), 0.f, 0.f), Quaternion::identity(), Vector3::one());
+            entity.make<Velocity>(Vector3(0.f, 1.f, 0.f));
+        }
+
+        SceneView<Transform, Velocity> view(scene);
+        size_t                         expectedUpdates = 0;
+
+        const auto update = [](Transform& transform, Velocity& velocity)
+        {
+            transform.setPosition(transform.getPosition() + velocity.m_value * .016f);
+            ++velocity.m_updateCount;
+        };
+
+        const double sequentialTime = measure([&]
+        {
+            view.each(update);
+        });
+
+        ++expectedUpdates;
+        DEBUG_LOG("Sequential: %.3fms", sequentialTime);
+
+        const unsigned maxThreads = std::max(std::thread::hardware_concurrency(), 1u);
+
+        for (unsigned threadCount = 1; threadCount <= maxThreads; ++threadCount)
+        {
+            // The calling thread processes a chunk as well
+            ThreadPool threadPool(threadCount - 1);
+
+            const double parallelTime = measure([&]
+            {
+                view.parallelEach(threadPool, update, 16384);
+            });
+
+            ++expectedUpdates;
+            DEBUG_LOG("%u thread(s): %.3fms (x%.2f)", threadCount, parallelTime, sequentialTime / parallelTime);
+        }
+
+        SceneGroup<Transform, Velocity>& group = *scene.group<Transform, Velocity>();
+
+        const double groupTime = measure([&]
+        {
+            group.each(update);
+        });
+
+        ++expectedUpdates;
+        DEBUG_LOG("Owning group: %.3fms (x%.2f)", groupTime, sequentialTime / groupTime);
+
+        size_t mismatchCount = 0;
+
+        for (const Velocity& velocity : scene.getStorage<Velocity>())
+            mismatchCount += velocity.m_updateCount != expectedUpdates;
+
+        TEST_CHECK(mismatchCount == 0, "%llu entities weren't updated exactly %llu times", mismatchCount, expectedUpdates);
+
+        std::atomic<size_t> visitedCount = 0;
+
+        std::as_const(view).parallelEach(PTH_SERVICE(ThreadPool), [&visitedCount](const Entity, const Transform&, const Velocity&)
+        {
+            visitedCount.fetch_add(1, std::memory_order_relaxed);
+        });
+
+        TEST_CHECK(visitedCount == m_entityCount, "Visited %llu/%llu entities", visitedCount.load(), m_entityCount);
+
+        // Transforms are always stored in sparse sets - compare the storage modes with plain components
+        for (const Scene::EStorageMode storageMode : { Scene::EStorageMode::SPARSE_SET, Scene::EStorageMode::ARCHETYPE })
+        {
+            Scene modeScene(storageMode);
+
+            for (size_t i = 0; i < m_entityCount; ++i)
+            {
+                EntityHandle entity = modeScene.create();
+                entity.make<Position>(Vector3(static_cast<float>(i), 0.f, 0.f));
+                entity.make<Velocity>(Vector3(0.f, 1.f, 0.f));
+            }
+
+            SceneView<Position, Velocity> modeView(modeScene);
+
+            const auto move = [](Position& position, Velocity& velocity)
+            {
+                position.m_value = position.m_value + velocity.m_value * .016f;
+                ++velocity.m_updateCount;
+            };
+
+            const double modeTime = measure([&]
+            {
+                modeView.each(move);
+            });
+
+            const char* modeName = storageMode == Scene::EStorageMode::ARCHETYPE ? "Archetypes" : "Sparse sets";
+            DEBUG_LOG("%s: %.3fms (x%.2f)", modeName, modeTime, sequentialTime / modeTime);
+
+            mismatchCount = 0;
+
+            modeView.each([&mismatchCount](const Position&, const Velocity& velocity)
+            {
+                mismatchCount += velocity.m_updateCount != 1;
+            });
+
+            TEST_CHECK(mismatchCount == 0, "%s: %llu entities weren't updated exactly once", modeName, mismatchCount);
+        }
+
+        complete();
+    }
+}
@@ -1,11 +1,65 @@
 #include "PantheonTest/Tests/ThreadPoolTest.h"
 
+#include <PantheonCore/Utility/Parallel.h>
 #include <PantheonCore/Utility/ServiceLocator.h>
+#include <PantheonCore/Utility/TaskGraph.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <random>
 
 using namespace PantheonCore::Utility;
 
 namespace PantheonTest
 {
+    namespace
+    {
+        constexpr size_t EMPTY_TASK_COUNT     = 1'000'000;
+        constexpr size_t FORK_JOIN_LEAF_COUNT = 1 << 16;
+        constexpr size_t PARALLEL_ITEM_COUNT  = 1 << 20;
+        constexpr size_t PARALLEL_GRAIN_SIZE  = 1024;
+        constexpr size_t GRAPH_WIDTH          = 1024;
+        constexpr size_t GRAPH_RUN_COUNT      = 100;
+
+        template <typename Func>
+        double measure(Func&& func)
+        {
+            const auto start = std::chrono::high_resolution_clock::now();
+            func();
+            const auto end = std::chrono::high_resolution_clock::now();
+
+            return std::chrono::duration<double, std::milli>(end - start).count();
+        }
+
+        void yieldUntilIdle(const ThreadPool& threadPool)
+        {
+            while (threadPool.isBusy())
+                std::this_thread::yield();
+        }
+
+        size_t forkJoin(ThreadPool& threadPool, const size_t begin, const size_t end)
+        {
+            if (end - begin <= 1)
+                return end - begin;
+
+            const size_t middle = begin + (end - begin) / 2;
+
+            std::future<size_t> left = threadPool.enqueue([&threadPool, begin, middle]
+            {
+                return forkJoin(threadPool, begin, middle);
+            });
+
+            const size_t right = forkJoin(threadPool, middle, end);
+
+            // Help instead of blocking - every worker could otherwise end up waiting on a task queued behind it
+            threadPool.wait(left);
+
+            return left.get() + right;
+        }
+    }
+
     ThreadPoolTest::ThreadPoolTest(const size_t taskCount, const size_t taskDuration)
         : ThreadPoolTest("Thread Pool", taskCount, taskDuration)
     {
@@ -48,6 +102,361 @@ namespace PantheonTest
         end = std::chrono::high_resolution_clock::now();
         DEBUG_LOG("Multi thread: %dms", std::chrono::duration_cast<std::chrono::milliseconds>(end - start));
 
+        benchmarkScheduling();
+        testParallelAlgorithms();
+        testTaskGraph();
+        testWaiting();
         complete();
     }
+
+    void ThreadPoolTest::benchmarkScheduling()
+    {
+        DEBUG_LOG("Benchmarking thread pool scheduling - %llu empty tasks, fork-join over %llu leaves",
+            EMPTY_TASK_COUNT, FORK_JOIN_LEAF_COUNT);
+
+        for (unsigned threadCount = 1; threadCount <= 16; threadCount *= 2)
+        {
+            ThreadPool threadPool(threadCount);
+
+            const double externalTime = measure([&threadPool]
+            {
+                for (size_t i = 0; i < EMPTY_TASK_COUNT; ++i)
+                    threadPool.enqueue([] {});
+
+                yieldUntilIdle(threadPool);
+            });
+
+            // The calling thread drains the queue along with the workers
+            const double helpingTime = measure([&threadPool]
+            {
+                for (size_t i = 0; i < EMPTY_TASK_COUNT; ++i)
+                    threadPool.enqueue([] {});
+
+                threadPool.waitIdle();
+            });
+
+            // Tasks submitted from a worker go to its own deque and get stolen by the others
+            const double localTime = measure([&threadPool]
+            {
+                threadPool.enqueue([&threadPool]
+                {
+                    for (size_t i = 0; i < EMPTY_TASK_COUNT; ++i)
+                        threadPool.enqueue([] {});
+                });
+
+                threadPool.waitIdle();
+            });
+
+            // Fire-and-forget tasks tracked by a counter don't allocate once the pool's task blocks are warm
+            std::atomic<size_t> executedCount = 0;
+            TaskCounter         counter;
+
+            const double submitTime = measure([&threadPool, &executedCount, &counter]
+            {
+                threadPool.submit([&threadPool, &executedCount, &counter]
+                {
+                    for (size_t i = 0; i < EMPTY_TASK_COUNT; ++i)
+                    {
+                        threadPool.submit([&executedCount]
+                        {
+                            executedCount.fetch_add(1, std::memory_order_relaxed);
+                        }, counter);
+                    }
+                }, counter);
+
+                threadPool.wait(counter);
+            });
+
+            TEST_CHECK(executedCount == EMPTY_TASK_COUNT, "%llu submitted tasks should have been executed - Executed %llu",
+                EMPTY_TASK_COUNT, executedCount.load());
+
+            size_t leafCount = 0;
+
+            const double forkJoinTime = measure([&threadPool, &leafCount]
+            {
+                leafCount = threadPool.enqueue(forkJoin, std::ref(threadPool), 0, FORK_JOIN_LEAF_COUNT).get();
+            });
+
+            TEST_CHECK(leafCount == FORK_JOIN_LEAF_COUNT, "Fork-join should reach %llu leaves - Reached %llu",
+                FORK_JOIN_LEAF_COUNT, leafCount);
+
+            // Same fork-join with the calling thread as an extra worker
+            const double forkJoinHelpingTime = measure([&threadPool, &leafCount]
+            {
+                leafCount = forkJoin(threadPool, 0, FORK_JOIN_LEAF_COUNT);
+            });
+
+            TEST_CHECK(leafCount == FORK_JOIN_LEAF_COUNT, "Helped fork-join should reach %llu leaves - Reached %llu",
+                FORK_JOIN_LEAF_COUNT, leafCount);
+
+            DEBUG_LOG("%u thread(s): enqueue %.3fms (external) / %.3fms (external, helping) / %.3fms (from a worker) | submit %.3fms"
+                " | fork-join %.3fms / %.3fms (helping)", threadCount, externalTime, helpingTime, localTime, submitTime, forkJoinTime,
+                forkJoinHelpingTime);
+        }
+    }
+
+    void ThreadPoolTest::testParallelAlgorithms()
+    {
+        DEBUG_LOG("Testing parallel algorithms - %llu items, grain size of %llu", PARALLEL_ITEM_COUNT, PARALLEL_GRAIN_SIZE);
+
+        std::vector<uint32_t> values(PARALLEL_ITEM_COUNT);
+        std::mt19937          generator(42);
+
+        for (uint32_t& value : values)
+            value = generator();
+
+        // Each index should be visited exactly once, by a single piece
+        std::vector<uint8_t> visits(PARALLEL_ITEM_COUNT, 0);
+
+        const double forTime = measure([this, &visits]
+        {
+            parallelFor(*m_threadPool, static_cast<size_t>(0), PARALLEL_ITEM_COUNT, PARALLEL_GRAIN_SIZE, [&visits](const size_t i)
+            {
+                ++visits[i];
+            });
+        });
+
+        const bool isVisitedOnce = std::all_of(visits.begin(), visits.end(), [](const uint8_t count)
+        {
+            return count == 1;
+        });
+
+        TEST_CHECK(isVisitedOnce, "parallelFor should visit each index exactly once");
+
+        size_t pieceCount = 0;
+        size_t itemCount  = 0;
+
+        // Called from one of the pool's tasks - the caller has to help instead of blocking its worker
+        m_threadPool->enqueue([this, &pieceCount, &itemCount]
+        {
+            std::atomic<size_t> pieces = 0;
+            std::atomic<size_t> items  = 0;
+
+            parallelFor(*m_threadPool, 0, static_cast<int>(PARALLEL_ITEM_COUNT), PARALLEL_GRAIN_SIZE,
+                [&pieces, &items](const int first, const int last)
+                {
+                    pieces.fetch_add(1, std::memory_order_relaxed);
+                    items.fetch_add(static_cast<size_t>(last - first), std::memory_order_relaxed);
+                });
+
+            pieceCount = pieces;
+            itemCount  = items;
+        }).wait();
+
+        TEST_CHECK(itemCount == PARALLEL_ITEM_COUNT, "parallelFor pieces should cover %llu items - Covered %llu",
+            PARALLEL_ITEM_COUNT, itemCount);
+        TEST_CHECK(pieceCount >= PARALLEL_ITEM_COUNT / PARALLEL_GRAIN_SIZE,
+            "parallelFor pieces should be at most %llu items long - Received %llu pieces", PARALLEL_GRAIN_SIZE, pieceCount);
+
+        const uint64_t expectedSum = std::accumulate(values.begin(), values.end(), static_cast<uint64_t>(0));
+        uint64_t       sum         = 0;
+
+        const double reduceTime = measure([this, &values, &sum]
+        {
+            sum = parallelReduce(*m_threadPool, values.cbegin(), values.cend(), PARALLEL_GRAIN_SIZE, static_cast<uint64_t>(0),
+                [](const std::vector<uint32_t>::const_iterator it)
+                {
+                    return static_cast<uint64_t>(*it);
+                });
+        });
+
+        TEST_CHECK(sum == expectedSum, "parallelReduce sum should be %llu - Received %llu", expectedSum, sum);
+
+        const uint64_t maxValue = parallelReduce(*m_threadPool, static_cast<size_t>(0), values.size(), PARALLEL_GRAIN_SIZE,
+            static_cast<uint64_t>(0), [&values](const size_t first, const size_t last)
+            {
+                return static_cast<uint64_t>(*std::max_element(values.begin() + first, values.begin() + last));
+            }, [](const uint64_t a, const uint64_t b)
+            {
+                return std::max(a, b);
+            });
+
+        TEST_CHECK(maxValue == *std::max_element(values.begin(), values.end()), "parallelReduce max should be %u - Received %llu",
+            *std::max_element(values.begin(), values.end()), maxValue);
+
+        // Boolean pieces must not share storage - a packed vector<bool> would race on the bits' words
+        const uint32_t maxElement = *std::max_element(values.begin(), values.end());
+
+        const bool hasMax = parallelReduce(*m_threadPool, values.cbegin(), values.cend(), 16, false,
+            [maxElement](const std::vector<uint32_t>::const_iterator it)
+            {
+                return *it == maxElement;
+            }, std::logical_or<>());
+
+        const bool areAllEven = parallelReduce(*m_threadPool, static_cast<size_t>(0), PARALLEL_ITEM_COUNT, 16, true,
+            [](const size_t i)
+            {
+                return i % 2 == 0;
+            }, std::logical_and<>());
+
+        TEST_CHECK(hasMax && !areAllEven, "parallelReduce should support boolean reductions");
+
+        std::vector<uint32_t> expected = values;
+
+        const double sortTime = measure([&expected]
+        {
+            std::sort(expected.begin(), expected.end());
+        });
+
+        const double parallelSortTime = measure([this, &values]
+        {
+            parallelSort(*m_threadPool, values.begin(), values.end());
+        });
+
+        TEST_CHECK(values == expected, "parallelSort should sort the values like std::sort");
+
+        parallelSort(*m_threadPool, values.begin(), values.begin() + 12345, std::greater<>(), 100);
+
+        TEST_CHECK(std::is_sorted(values.begin(), values.begin() + 12345, std::greater<>()),
+            "parallelSort should sort partial ranges with a custom comparison");
+
+        DEBUG_LOG("%u thread(s): parallelFor %.3fms | parallelReduce %.3fms | std::sort %.3fms / parallelSort %.3fms",
+            m_threadPool->getWorkersCount(), forTime, reduceTime, sortTime, parallelSortTime);
+    }
+
+    void ThreadPoolTest::testTaskGraph()
+    {
+        DEBUG_LOG("Testing task graph - diamond dependencies, then %llu runs of a graph with %llu parallel nodes",
+            GRAPH_RUN_COUNT, GRAPH_WIDTH);
+
+        // decode -> (mips, physics) -> upload, with each node recording its completion order
+        std::atomic<size_t> step = 0;
+        size_t              order[4] {};
+
+        TaskGraph graph;
+
+        const TaskGraph::NodeId decode = graph.addNode("Decode", [&step, &order]
+        {
+            order[0] = step.fetch_add(1);
+        });
+
+        const TaskGraph::NodeId mips = graph.addNode("Mip chains", [&step, &order]
+        {
+            order[1] = step.fetch_add(1);
+        });
+
+        const TaskGraph::NodeId physics = graph.addNode("Physics", [&step, &order]
+        {
+            order[2] = step.fetch_add(1);
+        });
+
+        const TaskGraph::NodeId upload = graph.addNode("Upload", [&step, &order]
+        {
+            order[3] = step.fetch_add(1);
+        });
+
+        graph.addDependency(mips, decode);
+        graph.addDependency(physics, decode);
+        graph.addDependency(upload, mips);
+        graph.addDependency(upload, physics);
+
+        TEST_CHECK(graph.getNodeCount() == 4, "Task graph should have 4 nodes - Received %llu", graph.getNodeCount());
+
+        for (size_t run = 0; run < 2; ++run)
+        {
+            step = 0;
+            graph.run(*m_threadPool);
+
+            TEST_CHECK(step == 4, "Each task graph node should run once per run - Received %llu executions", step.load());
+            TEST_CHECK(order[0] == 0 && order[3] == 3, "Task graph nodes should run after their predecessors");
+            TEST_CHECK(graph.getTiming(upload).m_start >= graph.getTiming(mips).m_start + graph.getTiming(mips).m_duration,
+                "Task graph node timings should follow the dependencies");
+        }
+
+        // Run from one of the pool's tasks - the caller has to help instead of blocking its worker
+        step = 0;
+        m_threadPool->enqueue([this, &graph]
+        {
+            graph.run(*m_threadPool);
+        }).wait();
+
+        TEST_CHECK(step == 4, "Task graph should run from the pool's tasks - Received %llu executions", step.load());
+
+        // Fan out, fan in - the graph is reused across runs like a frame would be
+        std::atomic<size_t> executedCount = 0;
+        TaskGraph           wideGraph;
+
+        const TaskGraph::NodeId root = wideGraph.addNode("Root", [] {});
+        const TaskGraph::NodeId sink = wideGraph.addNode("Sink", [] {});
+
+        for (size_t i = 0; i < GRAPH_WIDTH; ++i)
+        {
+            const TaskGraph::NodeId node = wideGraph.addNode("Leaf", [&executedCount]
+            {
+                executedCount.fetch_add(1, std::memory_order_relaxed);
+            });
+
+            wideGraph.addDependency(node, root);
+            wideGraph.addDependency(sink, node);
+        }
+
+        const double runTime = measure([this, &wideGraph]
+        {
+            for (size_t i = 0; i < GRAPH_RUN_COUNT; ++i)
+                wideGraph.run(*m_threadPool);
+        });
+
+        TEST_CHECK(executedCount == GRAPH_WIDTH * GRAPH_RUN_COUNT, "Task graph leaves should run %llu times - Received %llu",
+            GRAPH_WIDTH * GRAPH_RUN_COUNT, executedCount.load());
+
+        DEBUG_LOG("%u thread(s): %.3fms per run of %llu nodes\n%s", m_threadPool->getWorkersCount(), runTime / GRAPH_RUN_COUNT,
+            wideGraph.getNodeCount(), graph.dumpTimings().c_str());
+    }
+
+    void ThreadPoolTest::testWaiting()
+    {
+        DEBUG_LOG("Testing thread pool waits - %llu tasks", m_taskCount);
+
+        // Without workers, only the waiting thread can execute the tasks
+        ThreadPool          emptyPool(0);
+        std::atomic<size_t> executedCount = 0;
+        TaskCounter         counter;
+
+        for (size_t i = 0; i < m_taskCount; ++i)
+        {
+            emptyPool.submit([&executedCount]
+            {
+                executedCount.fetch_add(1, std::memory_order_relaxed);
+            }, counter);
+        }
+
+        TEST_CHECK(emptyPool.isBusy(), "Thread pool should be busy until its tasks are executed");
+
+        emptyPool.wait(counter);
+        TEST_CHECK(counter.isDone(), "Waiting for a counter should execute its tasks");
+        TEST_CHECK(executedCount == m_taskCount, "%llu tasks should have been executed - Executed %llu", m_taskCount,
+            executedCount.load());
+
+        for (size_t i = 0; i < m_taskCount; ++i)
+        {
+            emptyPool.submit([&executedCount]
+            {
+                executedCount.fetch_add(1, std::memory_order_relaxed);
+            });
+        }
+
+        emptyPool.waitIdle();
+        TEST_CHECK(!emptyPool.isBusy(), "Thread pool shouldn't be busy after waiting for it to be idle");
+        TEST_CHECK(executedCount == 2 * m_taskCount, "%llu tasks should have been executed - Executed %llu", 2 * m_taskCount,
+            executedCount.load());
+
+        // A single worker waiting on a nested task's future would deadlock with future::get
+        ThreadPool singlePool(1);
+
+        std::future<size_t> future = singlePool.enqueue([&singlePool]
+        {
+            std::future<size_t> nested = singlePool.enqueue([]
+            {
+                return static_cast<size_t>(42);
+            });
+
+            singlePool.wait(nested);
+            return nested.get();
+        });
+
+        singlePool.wait(future);
+        const size_t result = future.get();
+
+        TEST_CHECK(result == 42, "Nested task result should be 42 - Received %llu", result);
+    }
 }